@@ -1257,6 +1257,1085 @@ public class Benchmarks : JobComponentSystem {
 		}
 	}
 
+	// SGEMM
+
+	[BurstCompile(FloatPrecision.Standard, FloatMode.Fast, CompileSynchronously = true)]
+	public unsafe struct SgemmBurst : IJob {
+		public uint size;
+		public uint iterations;
+		public float result;
+
+		public void Execute() {
+			result = Sgemm(size, iterations);
+		}
+
+		private const uint blockRows = 64;
+		private const uint blockDepth = 256;
+		private const uint blockColumns = 512;
+
+		private float Sgemm(uint size, uint iterations) {
+			float* a = (float*)UnsafeUtility.Malloc(size * size * sizeof(float), 64, Allocator.Persistent);
+			float* b = (float*)UnsafeUtility.Malloc(size * size * sizeof(float), 64, Allocator.Persistent);
+			float* c = (float*)UnsafeUtility.Malloc(size * size * sizeof(float), 64, Allocator.Persistent);
+			float* packedA = (float*)UnsafeUtility.Malloc(blockRows * blockDepth * sizeof(float), 64, Allocator.Persistent);
+			float* packedB = (float*)UnsafeUtility.Malloc(blockDepth * blockColumns * sizeof(float), 64, Allocator.Persistent);
+
+			for (uint i = 0; i < size; i++) {
+				for (uint j = 0; j < size; j++) {
+					a[i * size + j] = (float)((int)((i * 3 + j) % 8) - 4) * 0.5f;
+					b[i * size + j] = (float)((int)((i + j * 5) % 8) - 4) * 0.25f;
+					c[i * size + j] = 0.0f;
+				}
+			}
+
+			for (uint i = 0; i < iterations; i++) {
+				Multiply(a, b, c, size, packedA, packedB);
+			}
+
+			double trace = 0.0;
+
+			for (uint i = 0; i < size; i++) {
+				trace += c[i * size + i];
+			}
+
+			UnsafeUtility.Free(a, Allocator.Persistent);
+			UnsafeUtility.Free(b, Allocator.Persistent);
+			UnsafeUtility.Free(c, Allocator.Persistent);
+			UnsafeUtility.Free(packedA, Allocator.Persistent);
+			UnsafeUtility.Free(packedB, Allocator.Persistent);
+
+			return (float)trace;
+		}
+
+		private void Multiply(float* a, float* b, float* c, uint size, float* packedA, float* packedB) {
+			for (uint jj = 0; jj < size; jj += blockColumns) {
+				uint nc = Min(blockColumns, size - jj);
+
+				for (uint kk = 0; kk < size; kk += blockDepth) {
+					uint kc = Min(blockDepth, size - kk);
+
+					for (uint k = 0; k < kc; k++) {
+						for (uint j = 0; j < nc; j++) {
+							packedB[k * nc + j] = b[(kk + k) * size + jj + j];
+						}
+					}
+
+					for (uint ii = 0; ii < size; ii += blockRows) {
+						uint mc = Min(blockRows, size - ii);
+
+						for (uint i = 0; i < mc; i++) {
+							for (uint k = 0; k < kc; k++) {
+								packedA[i * kc + k] = a[(ii + i) * size + kk + k];
+							}
+						}
+
+						for (uint i = 0; i < mc; i++) {
+							float* row = &c[(ii + i) * size + jj];
+
+							for (uint k = 0; k < kc; k++) {
+								float scalar = packedA[i * kc + k];
+								float* panel = &packedB[k * nc];
+
+								for (uint j = 0; j < nc; j++) {
+									row[j] += scalar * panel[j];
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		private uint Min(uint left, uint right) {
+			return left < right ? left : right;
+		}
+	}
+
+	[BurstCompile(FloatPrecision.Standard, FloatMode.Fast, CompileSynchronously = true)]
+	private unsafe struct SgemmGCC : IJob {
+		public uint size;
+		public uint iterations;
+		public float result;
+
+		public void Execute() {
+			result = benchmark_sgemm(size, iterations);
+		}
+	}
+
+	// Runner
+
+	[StructLayout(LayoutKind.Sequential)]
+	private struct RunnerClock {
+		public ulong timestamp, nanoseconds, aperf, mperf;
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	private struct HistogramSummary {
+		public ulong count, minimum, maximum, outliers;
+		public double mean, p50, p90, p99, p999;
+	}
+
+	private static double clockReference;
+
+	private static string ClockStability(bool enabled, ref RunnerClock begin, ref RunnerClock end) {
+		const double tolerance = 0.02;
+
+		if (!enabled)
+			return String.Empty;
+
+		double ratio = benchmark_runner_clock_ratio(ref begin, ref end);
+		double frequency = benchmark_runner_clock_frequency(ref begin, ref end);
+
+		if (clockReference == 0.0)
+			clockReference = frequency;
+
+		double drift = frequency / clockReference - 1.0;
+
+		if (ratio > 0.0 && ratio < 1.0 - tolerance)
+			return " (unstable clock: throttled to " + ratio.ToString("P0") + " of nominal)";
+
+		if (Math.Abs(drift) > tolerance)
+			return " (unstable clock: " + drift.ToString("+0.0%;-0.0%") + " drift at " + frequency.ToString("F0") + " MHz)";
+
+		return String.Empty;
+	}
+
+	private static string EnergyReport(bool enabled, double begin, double end, double units) {
+		if (!enabled || begin < 0.0 || end < 0.0)
+			return String.Empty;
+
+		double joules = end - begin;
+
+		return " (" + joules.ToString("F3") + " J, " + (joules / units).ToString("G4") + " J per unit)";
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	private struct MemoryStatistics {
+		public ulong tracked, allocations, frees, bytes, peak;
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	private struct RunnerUsage {
+		public ulong resident, peakResident, minorFaults, majorFaults;
+	}
+
+	private static string MemoryReport(bool enabled, ulong stack, ref RunnerUsage begin, ref RunnerUsage end) {
+		const double kilobyte = 1024.0;
+
+		if (!enabled)
+			return String.Empty;
+
+		var statistics = default(MemoryStatistics);
+
+		benchmark_memory_statistics(ref statistics);
+
+		long residentGrowth = (long)end.peakResident - (long)begin.resident;
+		string heap = statistics.tracked != 0 ? statistics.allocations + " allocations, " + (statistics.bytes / kilobyte).ToString("F1") + " KB allocated, " + (statistics.peak / kilobyte).ToString("F1") + " KB peak heap, " : String.Empty;
+
+		return " [" + heap + (stack / kilobyte).ToString("F1") + " KB stack, " + (residentGrowth > 0 ? residentGrowth / kilobyte : 0.0).ToString("F0") + " KB peak RSS growth, " + (end.minorFaults - begin.minorFaults) + " minor and " + (end.majorFaults - begin.majorFaults) + " major page faults]";
+	}
+
+	// Samples the clock, the energy counters and, for native kernels, the memory footprint around one measured run
+
+	private struct Sample {
+		public bool clock, energy, memory, histograms, phases;
+		public uint stackPaintSize;
+
+		private bool native;
+		private RunnerClock clockBegin, clockEnd;
+		private double energyBegin, energyEnd;
+		private RunnerUsage usageBegin, usageEnd;
+		private ulong stack;
+
+		public void Begin(bool nativeKernel) {
+			native = nativeKernel;
+
+			if (native && histograms)
+				benchmark_histogram_reset();
+
+			if (native && phases)
+				benchmark_phases_reset();
+
+			// Resetting the peak resident set clears the referenced bits of the whole process, so it only happens when the footprint is reported
+
+			if (native && memory) {
+				benchmark_memory_reset();
+				benchmark_runner_usage_reset();
+				benchmark_runner_usage(ref usageBegin);
+			}
+
+			if (clock)
+				benchmark_runner_clock(ref clockBegin);
+
+			if (energy)
+				energyBegin = benchmark_runner_energy();
+
+			// The paint comes last and the scan first, the sampling calls around them would dirty the painted region
+
+			if (native && memory)
+				benchmark_memory_stack_paint(stackPaintSize);
+		}
+
+		public void End() {
+			if (native && memory)
+				stack = benchmark_memory_stack_usage();
+
+			if (energy)
+				energyEnd = benchmark_runner_energy();
+
+			if (clock)
+				benchmark_runner_clock(ref clockEnd);
+
+			if (native && memory)
+				benchmark_runner_usage(ref usageEnd);
+		}
+
+		public string Report(double units) {
+			string report = ClockStability(clock, ref clockBegin, ref clockEnd) + EnergyReport(energy, energyBegin, energyEnd, units);
+
+			return native ? report + MemoryReport(memory, stack, ref usageBegin, ref usageEnd) : report;
+		}
+	}
+
+	private static string HistogramReport(string name) {
+		const double outlierFactor = 4.0;
+
+		var summary = default(HistogramSummary);
+
+		benchmark_histogram_summary(ref summary, outlierFactor);
+
+		if (summary.count == 0)
+			return name + ": no per-iteration samples, build the native library with -DBENCHMARK_HISTOGRAMS";
+
+		return name + ": " + summary.count + " iterations, cycles mean " + summary.mean.ToString("F0") + " p50 " + summary.p50 + " p90 " + summary.p90 + " p99 " + summary.p99 + " p99.9 " + summary.p999 + " min " + summary.minimum + " max " + summary.maximum + ", " + summary.outliers + " outliers above " + outlierFactor + "x median";
+	}
+
+	private static string PhaseReport(string compiler, string name, string prefix) {
+		var culture = System.Globalization.CultureInfo.InvariantCulture;
+		var report = new System.Text.StringBuilder();
+		ulong total = 0;
+
+		for (int i = 0; i < benchmark_phases_count(); i++) {
+			if (Marshal.PtrToStringAnsi(benchmark_phase_name(i)).StartsWith(prefix + "."))
+				total += benchmark_phase_cycles(i);
+		}
+
+		report.Append("{\"compiler\":\"" + compiler + "\",\"benchmark\":\"" + name + "\",\"phases\":[");
+
+		for (int i = 0, reported = 0; i < benchmark_phases_count() && total > 0; i++) {
+			string phase = Marshal.PtrToStringAnsi(benchmark_phase_name(i));
+
+			if (!phase.StartsWith(prefix + "."))
+				continue;
+
+			ulong cycles = benchmark_phase_cycles(i);
+
+			if (reported++ > 0)
+				report.Append(",");
+
+			report.Append("{\"name\":\"" + phase.Substring(prefix.Length + 1) + "\",\"cycles\":" + cycles + ",\"calls\":" + benchmark_phase_calls(i) + ",\"share\":" + ((double)cycles / total).ToString("F4", culture) + "}");
+		}
+
+		report.Append("]}");
+
+		return report.ToString();
+	}
+
+	private struct SweepKernel {
+		public string name;
+		public uint elementSize;
+		public bool quadratic;
+		public Action<uint, uint> run;
+	}
+
+	private static bool nativeLoaded;
+
+	private static bool NativeLoaded() {
+		try {
+			benchmark_runner_processors(null, 0);
+
+			return true;
+		} catch (DllNotFoundException) {
+			return false;
+		} catch (EntryPointNotFoundException) {
+			return false;
+		}
+	}
+
+	// Without the native library the processors come from the process affinity mask, or all of them when it cannot be read
+
+	private static int[] Processors() {
+		int count = nativeLoaded ? benchmark_runner_processors(null, 0) : 0;
+
+		if (count == 0) {
+			var fallback = new System.Collections.Generic.List<int>();
+
+			try {
+				long affinity = (long)System.Diagnostics.Process.GetCurrentProcess().ProcessorAffinity;
+
+				for (int i = 0; i < 64; i++) {
+					if ((affinity & (1L << i)) != 0)
+						fallback.Add(i);
+				}
+			} catch (Exception) {
+				fallback.Clear();
+			}
+
+			for (int i = 0; fallback.Count == 0 && i < Math.Max(Environment.ProcessorCount, 1); i++) {
+				fallback.Add(i);
+			}
+
+			return fallback.ToArray();
+		}
+
+		var processors = new int[count];
+
+		benchmark_runner_processors(processors, count);
+
+		return processors;
+	}
+
+	// Without the native library the whole process is pinned, the managed benchmarks run on the calling thread anyway
+
+	private static bool Pin(int processor) {
+		if (nativeLoaded)
+			return benchmark_runner_pin(processor) != 0;
+
+		if (processor < 0 || processor >= 64)
+			return false;
+
+		try {
+			System.Diagnostics.Process.GetCurrentProcess().ProcessorAffinity = (IntPtr)(1L << processor);
+
+			return true;
+		} catch (Exception) {
+			return false;
+		}
+	}
+
+	// One logical processor of every physical core comes first, starting with the given one, the SMT siblings follow
+
+	private static int[] ProcessorsByCore(int first, out int cores) {
+		var primary = new System.Collections.Generic.List<int>();
+		var siblings = new System.Collections.Generic.List<int>();
+		var seen = new System.Collections.Generic.HashSet<int>();
+		var ordered = new System.Collections.Generic.List<int>();
+
+		if (first >= 0)
+			ordered.Add(first);
+
+		foreach (int processor in Processors()) {
+			if (processor != first)
+				ordered.Add(processor);
+		}
+
+		foreach (int processor in ordered) {
+			int core = benchmark_runner_core(processor);
+
+			if (core < 0 || seen.Add(core))
+				primary.Add(processor);
+			else
+				siblings.Add(processor);
+		}
+
+		cores = primary.Count;
+		primary.AddRange(siblings);
+
+		return primary.ToArray();
+	}
+
+	private static void Sweep(int processor) {
+		const ulong budget = 256 * 1024 * 1024;
+		const double tickLimit = 1.0;
+
+		var stopwatch = new System.Diagnostics.Stopwatch();
+		var caches = new ulong[3];
+		var sizes = new System.Collections.Generic.SortedSet<ulong>();
+
+		for (int i = 0; i < caches.Length; i++) {
+			caches[i] = benchmark_runner_cache_size(processor, i + 1);
+
+			if (caches[i] > 0) {
+				sizes.Add(caches[i] / 2);
+				sizes.Add(caches[i] * 2);
+			}
+
+			Debug.Log("L" + (i + 1) + " cache: " + (caches[i] / 1024) + " KB");
+		}
+
+		var kernels = new SweepKernel[] {
+			new SweepKernel { name = "Sieve of Eratosthenes", elementSize = 1, run = (iterations, elements) => benchmark_sieve_of_eratosthenes_sized(iterations, elements) },
+			new SweepKernel { name = "Particle Kinematics", elementSize = 24, run = (iterations, elements) => benchmark_particle_kinematics(elements, iterations) },
+			new SweepKernel { name = "Seahash", elementSize = 1, run = (iterations, elements) => benchmark_seahash_sized(iterations, elements) },
+			new SweepKernel { name = "Radix", elementSize = 8, run = (iterations, elements) => benchmark_radix_sized(iterations, elements) },
+			new SweepKernel { name = "Fireflies Flocking", elementSize = 36, quadratic = true, run = (iterations, elements) => benchmark_fireflies_flocking(elements, iterations) }
+		};
+
+		foreach (var kernel in kernels) {
+			string previousLevel = null;
+			double tick = 0.0;
+			ulong tickSize = 0;
+
+			foreach (ulong size in sizes) {
+				uint elements = (uint)(size / kernel.elementSize);
+				uint iterations = (uint)Math.Max(1UL, budget / size);
+				string level = "DRAM";
+
+				for (int i = caches.Length - 1; i >= 0; i--) {
+					if (caches[i] > 0 && size <= caches[i])
+						level = "L" + (i + 1);
+				}
+
+				if (previousLevel != null && level != previousLevel)
+					Debug.Log("(GCC) " + kernel.name + ": ---- " + previousLevel + " -> " + level + " ----");
+
+				previousLevel = level;
+
+				if (kernel.quadratic) {
+					// Separation and cohesion compare every boid against the whole flock, so the next tick is predicted from the last one before it runs
+					double scale = tickSize > 0 ? (double)size / tickSize : 0.0;
+
+					if (tick * scale * scale > tickLimit) {
+						Debug.Log("(GCC) " + kernel.name + " [" + (size / 1024) + " KB, " + level + "]: skipped, one tick of " + elements + " boids is predicted to take " + (tick * scale * scale).ToString("F0") + " s");
+
+						continue;
+					}
+
+					stopwatch.Restart();
+					kernel.run(1, elements);
+					stopwatch.Stop();
+
+					tick = stopwatch.Elapsed.TotalSeconds;
+					tickSize = size;
+					iterations = (uint)Math.Max(1.0, Math.Min(iterations, tickLimit / tick));
+				} else {
+					kernel.run(1, elements);
+				}
+
+				stopwatch.Restart();
+				kernel.run(iterations, elements);
+				stopwatch.Stop();
+
+				double seconds = stopwatch.Elapsed.TotalSeconds;
+
+				Debug.Log("(GCC) " + kernel.name + " [" + (size / 1024) + " KB, " + level + "]: " + (size * iterations / seconds / (1024 * 1024)).ToString("F0") + " MB/s");
+			}
+		}
+	}
+
+	private static void Latency(int processor, uint maximumSize, uint lookahead) {
+		const ulong loads = 1 << 22;
+
+		var caches = new ulong[3];
+		uint[] chains = { 2, 4, 8, 16 };
+		string previousLevel = null;
+
+		for (int i = 0; i < caches.Length; i++) {
+			caches[i] = benchmark_runner_cache_size(processor, i + 1);
+		}
+
+		for (ulong size = 4 * 1024; size <= maximumSize; size *= 2) {
+			string level = "DRAM";
+
+			for (int i = caches.Length - 1; i >= 0; i--) {
+				if (caches[i] > 0 && size <= caches[i])
+					level = "L" + (i + 1);
+			}
+
+			if (previousLevel != null && level != previousLevel)
+				Debug.Log("(GCC) Latency: ---- " + previousLevel + " -> " + level + " ----");
+
+			previousLevel = level;
+
+			var report = new System.Text.StringBuilder("(GCC) Latency [" + (size / 1024) + " KB, " + level + "]: " + benchmark_latency(size, 1, 0, 0, loads).ToString("F2") + " ns per load");
+
+			foreach (uint count in chains) {
+				report.Append(", " + count + " chains " + benchmark_latency(size, count, 0, 0, loads).ToString("F2") + " ns");
+			}
+
+			report.Append(", prefetch " + lookahead + " ahead " + benchmark_latency(size, 1, lookahead, 0, loads).ToString("F2") + " ns");
+
+			double huge = benchmark_latency(size, 1, 0, 1, loads);
+
+			report.Append(huge < 0.0 ? ", huge pages unavailable" : ", huge pages " + huge.ToString("F2") + " ns");
+
+			Debug.Log(report.ToString());
+		}
+	}
+
+	private enum BatchKernel : uint {
+		Fibonacci = 0,
+		Mandelbrot = 1,
+		NBody = 2,
+		SieveOfEratosthenes = 3,
+		PixarRaytracer = 4,
+		FirefliesFlocking = 5,
+		Polynomials = 6,
+		ParticleKinematics = 7,
+		Arcfour = 8,
+		Seahash = 9,
+		Radix = 10,
+		SieveOfEratosthenesSized = 11,
+		SeahashSized = 12,
+		RadixSized = 13,
+		NBodySpecialized = 14,
+		SieveOfEratosthenesSpecialized = 15,
+		PolynomialsSpecialized = 16,
+		ArcfourSpecialized = 17,
+		RadixSpecialized = 18,
+		Sgemm = 19,
+		ArcfourKeystream = 20
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	private struct BatchRun {
+		public BatchKernel kernel;
+		public uint repeat;
+		[MarshalAs(UnmanagedType.ByValArray, SizeConst = 3)]
+		public uint[] parameters;
+
+		public BatchRun(BatchKernel kernel, uint repeat, uint first, uint second = 0, uint third = 0) {
+			this.kernel = kernel;
+			this.repeat = repeat;
+			this.parameters = new uint[] { first, second, third };
+		}
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	private struct BatchResult {
+		public ulong integer;
+		public double real;
+		public ulong nanoseconds, minimum, cycles;
+	}
+
+	private static void Batch(string[] names, BatchRun[] runs) {
+		var stopwatch = new System.Diagnostics.Stopwatch();
+		var results = new BatchResult[runs.Length];
+		double ticksPerNanosecond = System.Diagnostics.Stopwatch.Frequency / 1e9;
+		ulong nativeNanoseconds = 0;
+
+		stopwatch.Restart();
+
+		int completed = benchmark_batch(runs, results, runs.Length);
+
+		stopwatch.Stop();
+
+		for (int i = 0; i < completed; i++) {
+			nativeNanoseconds += results[i].nanoseconds;
+
+			Debug.Log("(GCC batch) " + names[i] + ": " + (long)(results[i].minimum * ticksPerNanosecond) + " ticks (best of " + runs[i].repeat + ", " + (results[i].cycles / runs[i].repeat) + " cycles on average)");
+		}
+
+		Debug.Log("(GCC batch) " + completed + " runs in one call, " + (long)(stopwatch.ElapsedTicks - nativeNanoseconds * ticksPerNanosecond) + " ticks spent outside the kernels");
+	}
+
+	private static void Throughput(string[] names, BatchRun[] runs, int processor, int copies) {
+		var primary = new System.Collections.Generic.List<int>();
+		var siblings = new System.Collections.Generic.List<int>();
+		var cores = new System.Collections.Generic.Dictionary<int, int>();
+		var placements = new System.Collections.Generic.List<int[]>();
+		var labels = new System.Collections.Generic.List<string>();
+
+		// One logical processor of every physical core comes first, the SMT siblings follow
+
+		foreach (int i in Processors()) {
+			int core = benchmark_runner_core(i);
+
+			if (core < 0 || !cores.ContainsKey(core)) {
+				primary.Add(i);
+
+				if (core >= 0)
+					cores.Add(core, i);
+			} else {
+				siblings.Add(i);
+			}
+		}
+
+		int separate = Math.Min(copies, primary.Count);
+		int shared = Math.Min(copies, primary.Count + siblings.Count);
+
+		labels.Add("1 copy");
+		placements.Add(new int[] { processor });
+
+		if (separate > 1) {
+			labels.Add(separate + " copies on " + separate + " cores");
+			placements.Add(primary.GetRange(0, separate).ToArray());
+		}
+
+		if (shared > separate) {
+			var all = new System.Collections.Generic.List<int>(primary);
+
+			all.AddRange(siblings);
+			labels.Add(shared + " copies on " + separate + " cores with SMT");
+			placements.Add(all.GetRange(0, shared).ToArray());
+		}
+
+		if (siblings.Count > 0 && primary.Count > 1) {
+			int sibling = siblings[0];
+			int first = cores[benchmark_runner_core(sibling)];
+			int second = primary[0] != first ? primary[0] : primary[1];
+
+			labels.Add("2 copies on SMT siblings");
+			placements.Add(new int[] { first, sibling });
+			labels.Add("2 copies on separate cores");
+			placements.Add(new int[] { first, second });
+		}
+
+		if (siblings.Count == 0)
+			Debug.Log("(GCC throughput) No SMT siblings reported, copies run on separate cores only");
+
+		for (int i = 0; i < runs.Length; i++) {
+			double single = 0.0;
+
+			for (int p = 0; p < placements.Count; p++) {
+				int[] processors = placements[p];
+				var copyRuns = new BatchRun[processors.Length];
+				var results = new BatchResult[processors.Length];
+
+				for (int c = 0; c < copyRuns.Length; c++) {
+					copyRuns[c] = runs[i];
+				}
+
+				ulong wall = benchmark_throughput(copyRuns, processors, results, processors.Length);
+
+				if (wall == 0) {
+					Debug.Log("(GCC throughput) " + names[i] + " [" + labels[p] + "]: the copies could not be started or pinned");
+
+					continue;
+				}
+
+				double perCopy = 0.0;
+
+				foreach (BatchResult result in results) {
+					perCopy += (double)result.nanoseconds / runs[i].repeat / results.Length;
+				}
+
+				double throughput = processors.Length * runs[i].repeat / (wall / 1e9);
+
+				if (p == 0) {
+					single = perCopy;
+
+					Debug.Log("(GCC throughput) " + names[i] + " [" + labels[p] + "]: " + throughput.ToString("F2") + " runs/s");
+				} else if (single > 0.0) {
+					Debug.Log("(GCC throughput) " + names[i] + " [" + labels[p] + "]: " + throughput.ToString("F2") + " runs/s, " + (throughput * single / 1e9).ToString("F2") + "x one copy, per-copy slowdown " + (perCopy / single).ToString("F2") + "x");
+				}
+			}
+		}
+	}
+
+	private static void Specialized(uint repeat, uint nbodyAdvancements, uint sieveOfEratosthenesIterations, uint polynomialsIterations, uint arcfourIterations, uint radixIterations) {
+		if (benchmark_specialized_available() == 0) {
+			Debug.Log("(GCC) Specialized: unavailable, the native library was not built as C++");
+
+			return;
+		}
+
+		// Sieve and radix are compared against their sized variants, the only ones that take the size at runtime, and Arcfour against the variant that folds the keystream instead of returning the final index
+
+		string[] names = { "NBody", "Sieve of Eratosthenes", "Polynomials", "Arcfour", "Radix" };
+
+		// The specialized polynomial depends on no runtime value except the iteration count, so compilers fold its body to a constant
+
+		string[] notes = { String.Empty, String.Empty, ", constant-folded, not comparable", String.Empty, String.Empty };
+
+		var generic = new BatchRun[] {
+			new BatchRun(BatchKernel.NBody, repeat, nbodyAdvancements),
+			new BatchRun(BatchKernel.SieveOfEratosthenesSized, repeat, sieveOfEratosthenesIterations, 1024),
+			new BatchRun(BatchKernel.Polynomials, repeat, polynomialsIterations),
+			new BatchRun(BatchKernel.ArcfourKeystream, repeat, arcfourIterations),
+			new BatchRun(BatchKernel.RadixSized, repeat, radixIterations, 128)
+		};
+
+		var specialized = new BatchRun[] {
+			new BatchRun(BatchKernel.NBodySpecialized, repeat, nbodyAdvancements),
+			new BatchRun(BatchKernel.SieveOfEratosthenesSpecialized, repeat, sieveOfEratosthenesIterations),
+			new BatchRun(BatchKernel.PolynomialsSpecialized, repeat, polynomialsIterations),
+			new BatchRun(BatchKernel.ArcfourSpecialized, repeat, arcfourIterations),
+			new BatchRun(BatchKernel.RadixSpecialized, repeat, radixIterations)
+		};
+
+		var genericResults = new BatchResult[generic.Length];
+		var specializedResults = new BatchResult[specialized.Length];
+		double ticksPerNanosecond = System.Diagnostics.Stopwatch.Frequency / 1e9;
+
+		benchmark_batch(generic, genericResults, generic.Length);
+		benchmark_batch(specialized, specializedResults, specialized.Length);
+
+		for (int i = 0; i < names.Length; i++) {
+			BatchResult before = genericResults[i], after = specializedResults[i];
+			double difference = before.real != 0.0 ? Math.Abs(after.real / before.real - 1.0) : Math.Abs(after.real);
+			string results = before.integer != after.integer ? "results DIFFERENT" : difference != 0.0 ? "results differ by " + difference.ToString("E1") : "results identical";
+
+			Debug.Log("(GCC) " + names[i] + " specialized: " + (long)(after.minimum * ticksPerNanosecond) + " ticks against " + (long)(before.minimum * ticksPerNanosecond) + " ticks generic, " + ((double)before.minimum / Math.Max(after.minimum, 1)).ToString("F2") + "x speedup, " + results + notes[i]);
+		}
+	}
+
+	private static void SgemmVariants(uint size, int threads, int processor) {
+		int cores;
+		int[] processors = ProcessorsByCore(processor, out cores);
+
+		if (threads <= 0)
+			threads = cores;
+
+		threads = Math.Min(threads, processors.Length);
+
+		// Without pinning the workers are left to the scheduler, otherwise each one is pinned to a processor of its own, physical cores first
+
+		int[] placement = processor >= 0 ? processors : null;
+
+		string[] names = { "naive", "blocked", "micro-kernel", "micro-kernel, " + threads + " threads" };
+		uint[] variants = { 0, 1, 2, 2 };
+		uint[] counts = { 1, 1, 1, (uint)threads };
+		var stopwatch = new System.Diagnostics.Stopwatch();
+		RunnerClock clockBegin = default(RunnerClock);
+		RunnerClock clockEnd = default(RunnerClock);
+		uint width = benchmark_sgemm_vector_width();
+		float reference = 0.0f;
+
+		// Peak assumes two FMA ports, scalar SSE code is limited to one addition and one multiplication of four lanes per cycle
+
+		double flopsPerCycle = width > 0 ? 2.0 * 2.0 * width : 8.0;
+		double flops = 2.0 * size * size * size;
+
+		if (width == 0)
+			Debug.Log("(GCC) SGEMM: the library was built without AVX2 and FMA, the micro-kernel falls back to the blocked variant");
+
+		for (int i = 0; i < variants.Length; i++) {
+			benchmark_sgemm_variant(size, 1, variants[i], counts[i], placement);
+			benchmark_runner_clock(ref clockBegin);
+			stopwatch.Restart();
+
+			float trace = benchmark_sgemm_variant(size, 1, variants[i], counts[i], placement);
+
+			stopwatch.Stop();
+			benchmark_runner_clock(ref clockEnd);
+
+			if (float.IsNaN(trace)) {
+				Debug.Log("(GCC) SGEMM " + names[i] + ": the threads could not be started or pinned");
+
+				continue;
+			}
+
+			if (i == 0)
+				reference = trace;
+
+			double gigaflops = flops / stopwatch.Elapsed.TotalSeconds / 1e9;
+			double peak = benchmark_runner_clock_frequency(ref clockBegin, ref clockEnd) * 1e6 * flopsPerCycle * Math.Min(counts[i], (uint)cores) / 1e9;
+
+			Debug.Log("(GCC) SGEMM " + names[i] + ": " + gigaflops.ToString("F2") + " GFLOP/s at " + size + "x" + size + ", " + (gigaflops / peak).ToString("P1") + " of the " + peak.ToString("F1") + " GFLOP/s peak, trace " + (trace == reference ? "identical" : "DIFFERENT"));
+		}
+	}
+
+	private static void Scan(uint iterations, uint bufferLength) {
+		string[] names = { "newlines and commas", "needle search", "base64 round trip", "UTF-8 validation" };
+		var stopwatch = new System.Diagnostics.Stopwatch();
+		uint width = benchmark_scan_vector_width();
+		string simd = width == 32 ? "AVX2" : "SSE4.2";
+
+		if (width == 0)
+			Debug.Log("(GCC) Scan: the library was built without SSE4.2 and AVX2, the SIMD kernels fall back to the scalar references");
+
+		for (uint kernel = 0; kernel < names.Length; kernel++) {
+			var gigabytes = new double[2];
+			var results = new ulong[2];
+
+			for (int vectorized = 0; vectorized < 2; vectorized++) {
+				benchmark_scan(kernel, vectorized, 1, bufferLength);
+				stopwatch.Restart();
+
+				results[vectorized] = benchmark_scan(kernel, vectorized, iterations, bufferLength);
+
+				stopwatch.Stop();
+				gigabytes[vectorized] = (double)bufferLength * iterations / stopwatch.Elapsed.TotalSeconds / 1e9;
+			}
+
+			Debug.Log("(GCC) Scan " + names[kernel] + ": scalar " + gigabytes[0].ToString("F2") + " GB/s, " + simd + " " + gigabytes[1].ToString("F2") + " GB/s, " + (gigabytes[1] / gigabytes[0]).ToString("F1") + "x over " + (bufferLength / (1024 * 1024)) + " MB, results " + (results[0] == results[1] && results[0] != 0 ? "identical" : "DIFFERENT"));
+		}
+	}
+
+	private static void PixarRaytracerPackets(uint width, uint height, uint samples) {
+		uint packet = benchmark_pixar_raytracer_packet_width();
+
+		if (packet == 0) {
+			Debug.Log("(GCC) Pixar Raytracer packets: the library was built without AVX2 or AVX-512");
+
+			return;
+		}
+
+		string[] buckets = { "bounce 1", "bounce 2", "bounce 3", "shadow rays" };
+		uint rays = width * height * samples;
+		var scalarHits = new byte[rays];
+		var packetHits = new byte[rays];
+		var statistics = new ulong[12];
+		var stopwatch = new System.Diagnostics.Stopwatch();
+
+		stopwatch.Restart();
+
+		float scalarRadiance = benchmark_pixar_raytracer_packet(width, height, samples, 0, scalarHits, null);
+
+		stopwatch.Stop();
+
+		double scalarRays = rays / stopwatch.Elapsed.TotalSeconds;
+
+		stopwatch.Restart();
+
+		float packetRadiance = benchmark_pixar_raytracer_packet(width, height, samples, 1, packetHits, statistics);
+
+		stopwatch.Stop();
+
+		double packetRays = rays / stopwatch.Elapsed.TotalSeconds;
+		uint identical = 0;
+
+		for (int i = 0; i < rays; i++) {
+			if (scalarHits[i] == packetHits[i])
+				identical++;
+		}
+
+		Debug.Log("(GCC) Pixar Raytracer packets: scalar " + scalarRays.ToString("F0") + " rays/s, " + packet + " lanes " + packetRays.ToString("F0") + " rays/s, " + (packetRays / scalarRays).ToString("F1") + "x, first hits identical for " + ((double)identical / rays).ToString("P2") + " of rays, mean radiance " + scalarRadiance.ToString("F3") + " and " + packetRadiance.ToString("F3"));
+
+		for (int i = 0; i < buckets.Length; i++) {
+			ulong steps = statistics[i * 3 + 1];
+
+			Debug.Log("(GCC) Pixar Raytracer packets, " + buckets[i] + ": " + statistics[i * 3] + " rays, " + (steps > 0 ? ((double)statistics[i * 3 + 2] / (steps * packet)).ToString("P1") : "no") + " lane utilization over " + steps + " packet steps");
+		}
+	}
+
+	private const uint
+		MandelbrotCardioid = 1,
+		MandelbrotPeriodicity = 2,
+		MandelbrotDouble = 4;
+
+	[StructLayout(LayoutKind.Sequential)]
+	private struct MandelbrotView {
+		public double left, right, top, bottom;
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	private struct MandelbrotStatistics {
+		public ulong iterations, skipped, cardioid, bulb, periodic;
+	}
+
+	private static void MandelbrotOptimized(string precision, uint mode, uint width, uint height, uint iterations) {
+		var stopwatch = new System.Diagnostics.Stopwatch();
+		var view = new MandelbrotView { left = -2.1, right = 1.0, top = -1.3, bottom = 1.3 };
+		var bruteForce = default(MandelbrotStatistics);
+		var optimized = default(MandelbrotStatistics);
+		uint fastPaths = mode | MandelbrotCardioid | MandelbrotPeriodicity;
+
+		benchmark_mandelbrot_optimized(width, height, iterations, mode, ref view, ref bruteForce);
+
+		stopwatch.Restart();
+
+		ulong bruteForceChecksum = benchmark_mandelbrot_optimized(width, height, iterations, mode, ref view, ref bruteForce);
+		long bruteForceTime = stopwatch.ElapsedTicks;
+
+		benchmark_mandelbrot_optimized(width, height, iterations, fastPaths, ref view, ref optimized);
+
+		stopwatch.Restart();
+
+		ulong optimizedChecksum = benchmark_mandelbrot_optimized(width, height, iterations, fastPaths, ref view, ref optimized);
+		long optimizedTime = stopwatch.ElapsedTicks;
+
+		Debug.Log("(GCC) Mandelbrot optimized (" + precision + "): " + optimizedTime + " ticks against " + bruteForceTime + " ticks brute force, " + ((double)bruteForceTime / optimizedTime).ToString("F2") + "x speedup, " + ((double)optimized.skipped / (optimized.iterations + optimized.skipped)).ToString("P1") + " of iterations skipped (" + optimized.cardioid + " cardioid, " + optimized.bulb + " bulb, " + optimized.periodic + " periodic pixels), iteration counts " + (optimizedChecksum == bruteForceChecksum ? "identical" : "DIFFERENT"));
+	}
+
+	private static void Store(string directory, uint samples, string[] names, BatchRun[] runs) {
+		var single = new BatchRun[runs.Length];
+		var results = new BatchResult[runs.Length];
+		var timings = new string[runs.Length][];
+		var culture = System.Globalization.CultureInfo.InvariantCulture;
+
+		for (int i = 0; i < runs.Length; i++) {
+			single[i] = runs[i];
+			single[i].repeat = 1;
+			timings[i] = new string[samples];
+		}
+
+		// Kernels are interleaved sample by sample, so a slow drift of the machine spreads over all of them instead of biasing one
+
+		benchmark_batch(single, results, single.Length);
+
+		for (uint s = 0; s < samples; s++) {
+			benchmark_batch(single, results, single.Length);
+
+			for (int i = 0; i < runs.Length; i++)
+				timings[i][s] = results[i].nanoseconds.ToString(culture);
+		}
+
+		string host = Environment.MachineName;
+		string path = System.IO.Path.Combine(directory, DateTime.UtcNow.ToString("yyyyMMdd-HHmmss", culture) + "-" + host + ".tsv");
+
+		System.IO.Directory.CreateDirectory(directory);
+
+		using (var writer = new System.IO.StreamWriter(path)) {
+			writer.WriteLine("compiler\t" + Marshal.PtrToStringAnsi(benchmark_runner_compiler()));
+			writer.WriteLine("flags\t" + Marshal.PtrToStringAnsi(benchmark_runner_flags()));
+			writer.WriteLine("isa\t" + Marshal.PtrToStringAnsi(benchmark_runner_isa()));
+			writer.WriteLine("host\t" + host);
+			writer.WriteLine("date\t" + DateTime.UtcNow.ToString("o", culture));
+
+			for (int i = 0; i < runs.Length; i++)
+				writer.WriteLine("kernel\t" + names[i] + "\t" + string.Join(",", timings[i]));
+		}
+
+		Debug.Log("(GCC) Results: " + samples + " samples of " + runs.Length + " kernels stored in " + path);
+	}
+
+	private static System.Collections.Generic.Dictionary<string, double[]> LoadResults(string path, out string build) {
+		var kernels = new System.Collections.Generic.Dictionary<string, double[]>();
+		var tags = new System.Collections.Generic.Dictionary<string, string>();
+		var culture = System.Globalization.CultureInfo.InvariantCulture;
+
+		foreach (string line in System.IO.File.ReadAllLines(path)) {
+			string[] fields = line.Split('\t');
+
+			if (fields.Length == 3 && fields[0] == "kernel")
+				kernels[fields[1]] = Array.ConvertAll(fields[2].Split(','), value => double.Parse(value, culture));
+			else if (fields.Length == 2)
+				tags[fields[0]] = fields[1];
+		}
+
+		string Tag(string key) => tags.TryGetValue(key, out string value) ? value : "unknown";
+
+		build = Tag("compiler") + ", flags " + Tag("flags") + ", " + Tag("isa") + " on " + Tag("host") + " at " + Tag("date");
+
+		return kernels;
+	}
+
+	private static double Median(double[] values) {
+		var sorted = (double[])values.Clone();
+		int middle = sorted.Length / 2;
+
+		Array.Sort(sorted);
+
+		return sorted.Length % 2 == 1 ? sorted[middle] : (sorted[middle - 1] + sorted[middle]) * 0.5;
+	}
+
+	// Abramowitz and Stegun 7.1.26 approximation of the error function, accurate to 1.5e-7
+
+	private static double NormalDistribution(double z) {
+		double x = Math.Abs(z) / Math.Sqrt(2.0);
+		double t = 1.0 / (1.0 + 0.3275911 * x);
+		double error = 1.0 - ((((1.061405429 * t - 1.453152027) * t + 1.421413741) * t - 0.284496736) * t + 0.254829592) * t * Math.Exp(-x * x);
+
+		return z >= 0.0 ? 0.5 * (1.0 + error) : 0.5 * (1.0 - error);
+	}
+
+	// Two-sided Mann-Whitney U test with tie correction and the normal approximation, U counts the pairs where the baseline sample is slower
+
+	private static double MannWhitney(double[] baseline, double[] candidate, out double u) {
+		int n1 = baseline.Length, n2 = candidate.Length, n = n1 + n2;
+		var values = new double[n];
+		var owners = new int[n];
+		double rankSum = 0.0, ties = 0.0;
+
+		baseline.CopyTo(values, 0);
+		candidate.CopyTo(values, n1);
+
+		for (int i = 0; i < n; i++) {
+			owners[i] = i;
+		}
+
+		Array.Sort(values, owners);
+
+		for (int i = 0; i < n; ) {
+			int j = i;
+
+			while (j + 1 < n && values[j + 1] == values[i]) {
+				j++;
+			}
+
+			double rank = (i + j) * 0.5 + 1.0;
+			double tied = j - i + 1;
+
+			ties += tied * tied * tied - tied;
+
+			for (int k = i; k <= j; k++) {
+				if (owners[k] < n1)
+					rankSum += rank;
+			}
+
+			i = j + 1;
+		}
+
+		u = rankSum - n1 * (n1 + 1) * 0.5;
+
+		double deviation = Math.Sqrt(n1 * (double)n2 / 12.0 * ((n + 1) - ties / (n * (double)(n - 1))));
+
+		if (deviation == 0.0)
+			return 1.0;
+
+		double z = Math.Max(Math.Abs(u - n1 * (double)n2 * 0.5) - 0.5, 0.0) / deviation;
+
+		return Math.Min(2.0 * (1.0 - NormalDistribution(z)), 1.0);
+	}
+
+	// Percentile bootstrap of the relative change of the median, seeded so that repeated comparisons of the same files agree
+
+	private static void Bootstrap(double[] baseline, double[] candidate, int resamples, out double lower, out double upper) {
+		var random = new Random(1);
+		var changes = new double[resamples];
+		var baselineResample = new double[baseline.Length];
+		var candidateResample = new double[candidate.Length];
+
+		for (int r = 0; r < resamples; r++) {
+			for (int i = 0; i < baselineResample.Length; i++) {
+				baselineResample[i] = baseline[random.Next(baseline.Length)];
+			}
+
+			for (int i = 0; i < candidateResample.Length; i++) {
+				candidateResample[i] = candidate[random.Next(candidate.Length)];
+			}
+
+			changes[r] = Median(candidateResample) / Median(baselineResample) - 1.0;
+		}
+
+		Array.Sort(changes);
+
+		lower = changes[(int)(resamples * 0.025)];
+		upper = changes[Math.Min((int)(resamples * 0.975), resamples - 1)];
+	}
+
+	private static int Compare(string baselinePath, string candidatePath, double significance, double threshold) {
+		string baselineBuild, candidateBuild;
+		var baseline = LoadResults(baselinePath, out baselineBuild);
+		var candidate = LoadResults(candidatePath, out candidateBuild);
+		int regressions = 0;
+
+		Debug.Log("(Compare) Baseline: " + baselineBuild);
+		Debug.Log("(Compare) Candidate: " + candidateBuild);
+
+		foreach (var entry in baseline) {
+			double[] samples;
+
+			if (!candidate.TryGetValue(entry.Key, out samples)) {
+				Debug.Log("(Compare) " + entry.Key + ": missing from the candidate");
+
+				continue;
+			}
+
+			double u, lower, upper;
+			double p = MannWhitney(entry.Value, samples, out u);
+			double change = Median(samples) / Median(entry.Value) - 1.0;
+			double effect = 1.0 - 2.0 * u / (entry.Value.Length * (double)samples.Length);
+			string verdict = p >= significance ? "no significant change" : change > 0.0 ? "slowdown" : "speedup";
+
+			Bootstrap(entry.Value, samples, 2000, out lower, out upper);
+
+			if (p < significance && change > threshold) {
+				regressions++;
+				verdict += " beyond the threshold";
+			}
+
+			Debug.Log("(Compare) " + entry.Key + ": " + change.ToString("+0.0%;-0.0%") + " median time [" + lower.ToString("+0.0%;-0.0%") + ", " + upper.ToString("+0.0%;-0.0%") + "] 95% CI, p = " + p.ToString("F4") + ", rank-biserial " + effect.ToString("+0.00;-0.00") + ", " + verdict);
+		}
+
+		Debug.Log("(Compare) " + regressions + " significant regressions above " + threshold.ToString("P1") + " at p < " + significance);
+
+		return regressions > 0 ? 1 : 0;
+	}
+
 	protected override void OnCreate() {
 		var stopwatch = new System.Diagnostics.Stopwatch();
 		long time = 0;
@@ -1268,6 +2347,51 @@ public class Benchmarks : JobComponentSystem {
 			gccEnabled = true,
 			monoEnabled = true;
 
+		bool
+			pinningEnabled = true,
+			realtimeEnabled = false,
+			memoryLockingEnabled = false,
+			clockMonitoringEnabled = true,
+			energyEnabled = false,
+			memoryEnabled = false,
+			histogramsEnabled = false,
+			phasesEnabled = false,
+			sweepEnabled = false,
+			batchEnabled = false,
+			mandelbrotOptimizedEnabled = false,
+			storeEnabled = false,
+			specializedEnabled = false,
+			sgemmVariantsEnabled = false,
+			latencyEnabled = false,
+			scanEnabled = false,
+			pixarPacketsEnabled = false,
+			throughputEnabled = false;
+
+		int
+			pinnedProcessor = -1,
+			realtimePriority = 99,
+			sgemmThreads = 0,
+			throughputCopies = Environment.ProcessorCount;
+
+		uint
+			batchRepeat = 2,
+			stackPaintSize = 256 * 1024,
+			storeSamples = 15,
+			latencyMaximumSize = 512 * 1024 * 1024,
+			latencyLookahead = 8,
+			scanIterations = 50,
+			scanBufferLength = 16 * 1024 * 1024,
+			pixarPacketsSamples = 1;
+
+		double
+			compareSignificance = 0.01,
+			compareThreshold = 0.02;
+
+		string
+			storeDirectory = "results",
+			compareBaseline = null,
+			compareCandidate = null;
+
 		bool
 			fibonacciEnabled = true,
 			mandelbrotEnabled = true,
@@ -1279,7 +2403,8 @@ public class Benchmarks : JobComponentSystem {
 			particleKinematicsEnabled = true,
 			arcfourEnabled = true,
 			seahashEnabled = true,
-			radixEnabled = true;
+			radixEnabled = true,
+			sgemmEnabled = true;
 
 		uint
 			fibonacciNumber = 46,
@@ -1292,7 +2417,68 @@ public class Benchmarks : JobComponentSystem {
 			particleKinematicsIterations = 10000000,
 			arcfourIterations = 10000000,
 			seahashIterations = 1000000,
-			radixIterations = 1000000;
+			radixIterations = 1000000,
+			sgemmIterations = 100;
+
+		// Comparison
+
+		if (compareBaseline != null && compareCandidate != null) {
+			Compare(compareBaseline, compareCandidate, compareSignificance, compareThreshold);
+
+			return;
+		}
+
+		// Environment
+
+		nativeLoaded = NativeLoaded();
+
+		if (!nativeLoaded)
+			Debug.Log("Warning: the native library is missing, pinning falls back to the process affinity and the scheduler, governor, clock and energy controls are skipped");
+
+		int[] processors = Processors();
+
+		// A negative processor selects the last one in the affinity mask the runner was started with
+
+		if (pinnedProcessor < 0)
+			pinnedProcessor = processors[processors.Length - 1];
+
+		if (pinningEnabled && !Pin(pinnedProcessor))
+			Debug.Log("Warning: failed to pin the runner to processor " + pinnedProcessor);
+
+		if (realtimeEnabled && (!nativeLoaded || benchmark_runner_realtime(realtimePriority) == 0))
+			Debug.Log("Warning: failed to switch the runner to SCHED_FIFO");
+
+		if (memoryLockingEnabled && (!nativeLoaded || benchmark_runner_lock_memory() == 0))
+			Debug.Log("Warning: failed to lock the working set");
+
+		if (nativeLoaded) {
+			var governor = new byte[32];
+			int governorStatus = benchmark_runner_governor(pinningEnabled ? pinnedProcessor : 0, governor, governor.Length);
+
+			if (governorStatus == 0)
+				Debug.Log("Warning: scaling governor is '" + System.Text.Encoding.ASCII.GetString(governor).TrimEnd('\0') + "' instead of 'performance', results may be unstable");
+		}
+
+		if (energyEnabled && (!nativeLoaded || benchmark_runner_energy() < 0.0))
+			Debug.Log("Energy: unavailable, RAPL powercap counters are missing or not readable");
+
+		var sample = new Sample {
+			clock = clockMonitoringEnabled && nativeLoaded,
+			energy = energyEnabled && nativeLoaded,
+			memory = memoryEnabled,
+			histograms = histogramsEnabled,
+			phases = phasesEnabled,
+			stackPaintSize = stackPaintSize
+		};
+
+		// The first calls compile the stopwatch accessors and the sampling methods and bind the scan stub, inside a measured run they would dirty the painted stack
+
+		if (memoryEnabled && nativeLoaded) {
+			stopwatch.Restart();
+			time = stopwatch.ElapsedTicks;
+			sample.End();
+			benchmark_memory_stack_usage();
+		}
 
 		// Benchmarks
 
@@ -1304,12 +2490,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Burst) Fibonacci: " + time + " ticks");
+			Debug.Log("(Burst) Fibonacci: " + time + " ticks" + sample.Report(1));
 		}
 
 		if (gccEnabled && fibonacciEnabled) {
@@ -1320,12 +2508,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(true);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(GCC) Fibonacci: " + time + " ticks");
+			Debug.Log("(GCC) Fibonacci: " + time + " ticks" + sample.Report(1));
 		}
 
 		if (monoEnabled && fibonacciEnabled) {
@@ -1336,12 +2526,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Execute();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Execute();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Mono JIT) Fibonacci: " + time + " ticks");
+			Debug.Log("(Mono JIT) Fibonacci: " + time + " ticks" + sample.Report(1));
 		}
 
 		if (burstEnabled && mandelbrotEnabled) {
@@ -1354,12 +2546,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Burst) Mandelbrot: " + time + " ticks");
+			Debug.Log("(Burst) Mandelbrot: " + time + " ticks" + sample.Report(mandelbrotIterations));
 		}
 
 		if (gccEnabled && mandelbrotEnabled) {
@@ -1372,12 +2566,22 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(true);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
+
+			Debug.Log("(GCC) Mandelbrot: " + time + " ticks" + sample.Report(mandelbrotIterations));
+
+			if (histogramsEnabled)
+				Debug.Log(HistogramReport("(GCC) Mandelbrot"));
+		}
 
-			Debug.Log("(GCC) Mandelbrot: " + time + " ticks");
+		if (gccEnabled && mandelbrotEnabled && mandelbrotOptimizedEnabled) {
+			MandelbrotOptimized("float", 0, 1920, 1080, mandelbrotIterations);
+			MandelbrotOptimized("double", MandelbrotDouble, 1920, 1080, mandelbrotIterations);
 		}
 
 		if (monoEnabled && mandelbrotEnabled) {
@@ -1390,12 +2594,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Execute();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Execute();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Mono JIT) Mandelbrot: " + time + " ticks");
+			Debug.Log("(Mono JIT) Mandelbrot: " + time + " ticks" + sample.Report(mandelbrotIterations));
 		}
 
 		if (burstEnabled && nbodyEnabled) {
@@ -1406,12 +2612,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Burst) NBody: " + time + " ticks");
+			Debug.Log("(Burst) NBody: " + time + " ticks" + sample.Report(nbodyAdvancements));
 		}
 
 		if (gccEnabled && nbodyEnabled) {
@@ -1422,12 +2630,17 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(true);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
+
+			Debug.Log("(GCC) NBody: " + time + " ticks" + sample.Report(nbodyAdvancements));
 
-			Debug.Log("(GCC) NBody: " + time + " ticks");
+			if (histogramsEnabled)
+				Debug.Log(HistogramReport("(GCC) NBody"));
 		}
 
 		if (monoEnabled && nbodyEnabled) {
@@ -1438,12 +2651,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Execute();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Execute();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Mono JIT) NBody: " + time + " ticks");
+			Debug.Log("(Mono JIT) NBody: " + time + " ticks" + sample.Report(nbodyAdvancements));
 		}
 
 		if (burstEnabled && sieveOfEratosthenesEnabled) {
@@ -1454,12 +2669,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Burst) Sieve of Eratosthenes: " + time + " ticks");
+			Debug.Log("(Burst) Sieve of Eratosthenes: " + time + " ticks" + sample.Report(sieveOfEratosthenesIterations));
 		}
 
 		if (gccEnabled && sieveOfEratosthenesEnabled) {
@@ -1470,12 +2687,17 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(true);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(GCC) Sieve of Eratosthenes: " + time + " ticks");
+			Debug.Log("(GCC) Sieve of Eratosthenes: " + time + " ticks" + sample.Report(sieveOfEratosthenesIterations));
+
+			if (histogramsEnabled)
+				Debug.Log(HistogramReport("(GCC) Sieve of Eratosthenes"));
 		}
 
 		if (monoEnabled && sieveOfEratosthenesEnabled) {
@@ -1486,12 +2708,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Execute();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Execute();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Mono JIT) Sieve of Eratosthenes: " + time + " ticks");
+			Debug.Log("(Mono JIT) Sieve of Eratosthenes: " + time + " ticks" + sample.Report(sieveOfEratosthenesIterations));
 		}
 
 		if (burstEnabled && pixarRaytracerEnabled) {
@@ -1504,12 +2728,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Burst) Pixar Raytracer: " + time + " ticks");
+			Debug.Log("(Burst) Pixar Raytracer: " + time + " ticks" + sample.Report(720 * 480 * pixarRaytracerSamples));
 		}
 
 		if (gccEnabled && pixarRaytracerEnabled) {
@@ -1522,12 +2748,20 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(true);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
+
+			Debug.Log("(GCC) Pixar Raytracer: " + time + " ticks" + sample.Report(720 * 480 * pixarRaytracerSamples));
 
-			Debug.Log("(GCC) Pixar Raytracer: " + time + " ticks");
+			if (histogramsEnabled)
+				Debug.Log(HistogramReport("(GCC) Pixar Raytracer"));
+
+			if (phasesEnabled)
+				Debug.Log(PhaseReport("GCC", "Pixar Raytracer", "pixar_raytracer"));
 		}
 
 		if (monoEnabled && pixarRaytracerEnabled) {
@@ -1540,12 +2774,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Execute();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Execute();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Mono JIT) Pixar Raytracer: " + time + " ticks");
+			Debug.Log("(Mono JIT) Pixar Raytracer: " + time + " ticks" + sample.Report(720 * 480 * pixarRaytracerSamples));
 		}
 
 		if (burstEnabled && firefliesFlockingEnabled) {
@@ -1557,12 +2793,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Burst) Fireflies Flocking: " + time + " ticks");
+			Debug.Log("(Burst) Fireflies Flocking: " + time + " ticks" + sample.Report(firefliesFlockingLifetime));
 		}
 
 		if (gccEnabled && firefliesFlockingEnabled) {
@@ -1574,12 +2812,20 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(true);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
+
+			Debug.Log("(GCC) Fireflies Flocking: " + time + " ticks" + sample.Report(firefliesFlockingLifetime));
 
-			Debug.Log("(GCC) Fireflies Flocking: " + time + " ticks");
+			if (histogramsEnabled)
+				Debug.Log(HistogramReport("(GCC) Fireflies Flocking"));
+
+			if (phasesEnabled)
+				Debug.Log(PhaseReport("GCC", "Fireflies Flocking", "fireflies_flocking"));
 		}
 
 		if (monoEnabled && firefliesFlockingEnabled) {
@@ -1591,12 +2837,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Execute();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Execute();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Mono JIT) Fireflies Flocking: " + time + " ticks");
+			Debug.Log("(Mono JIT) Fireflies Flocking: " + time + " ticks" + sample.Report(firefliesFlockingLifetime));
 		}
 
 		if (burstEnabled && polynomialsEnabled) {
@@ -1607,12 +2855,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Burst) Polynomials: " + time + " ticks");
+			Debug.Log("(Burst) Polynomials: " + time + " ticks" + sample.Report(polynomialsIterations));
 		}
 
 		if (gccEnabled && polynomialsEnabled) {
@@ -1623,12 +2873,17 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(true);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
+
+			Debug.Log("(GCC) Polynomials: " + time + " ticks" + sample.Report(polynomialsIterations));
 
-			Debug.Log("(GCC) Polynomials: " + time + " ticks");
+			if (histogramsEnabled)
+				Debug.Log(HistogramReport("(GCC) Polynomials"));
 		}
 
 		if (monoEnabled && polynomialsEnabled) {
@@ -1639,12 +2894,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Execute();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Execute();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Mono JIT) Polynomials: " + time + " ticks");
+			Debug.Log("(Mono JIT) Polynomials: " + time + " ticks" + sample.Report(polynomialsIterations));
 		}
 
 		if (burstEnabled && particleKinematicsEnabled) {
@@ -1656,12 +2913,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Burst) Particle Kinematics: " + time + " ticks");
+			Debug.Log("(Burst) Particle Kinematics: " + time + " ticks" + sample.Report(particleKinematicsIterations));
 		}
 
 		if (gccEnabled && particleKinematicsEnabled) {
@@ -1673,12 +2932,17 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(true);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(GCC) Particle Kinematics: " + time + " ticks");
+			Debug.Log("(GCC) Particle Kinematics: " + time + " ticks" + sample.Report(particleKinematicsIterations));
+
+			if (histogramsEnabled)
+				Debug.Log(HistogramReport("(GCC) Particle Kinematics"));
 		}
 
 		if (monoEnabled && particleKinematicsEnabled) {
@@ -1690,12 +2954,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Execute();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Execute();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Mono JIT) Particle Kinematics: " + time + " ticks");
+			Debug.Log("(Mono JIT) Particle Kinematics: " + time + " ticks" + sample.Report(particleKinematicsIterations));
 		}
 
 		if (burstEnabled && arcfourEnabled) {
@@ -1706,12 +2972,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Burst) Arcfour: " + time + " ticks");
+			Debug.Log("(Burst) Arcfour: " + time + " ticks" + sample.Report(arcfourIterations));
 		}
 
 		if (gccEnabled && arcfourEnabled) {
@@ -1722,12 +2990,17 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(true);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
+
+			Debug.Log("(GCC) Arcfour: " + time + " ticks" + sample.Report(arcfourIterations));
 
-			Debug.Log("(GCC) Arcfour: " + time + " ticks");
+			if (histogramsEnabled)
+				Debug.Log(HistogramReport("(GCC) Arcfour"));
 		}
 
 		if (monoEnabled && arcfourEnabled) {
@@ -1738,12 +3011,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Execute();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Execute();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Mono JIT) Arcfour: " + time + " ticks");
+			Debug.Log("(Mono JIT) Arcfour: " + time + " ticks" + sample.Report(arcfourIterations));
 		}
 
 		if (burstEnabled && seahashEnabled) {
@@ -1754,12 +3029,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Burst) Seahash: " + time + " ticks");
+			Debug.Log("(Burst) Seahash: " + time + " ticks" + sample.Report(seahashIterations));
 		}
 
 		if (gccEnabled && seahashEnabled) {
@@ -1770,12 +3047,17 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(true);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(GCC) Seahash: " + time + " ticks");
+			Debug.Log("(GCC) Seahash: " + time + " ticks" + sample.Report(seahashIterations));
+
+			if (histogramsEnabled)
+				Debug.Log(HistogramReport("(GCC) Seahash"));
 		}
 
 		if (monoEnabled && seahashEnabled) {
@@ -1786,12 +3068,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Execute();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Execute();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Mono JIT) Seahash: " + time + " ticks");
+			Debug.Log("(Mono JIT) Seahash: " + time + " ticks" + sample.Report(seahashIterations));
 		}
 
 		if (burstEnabled && radixEnabled) {
@@ -1802,12 +3086,14 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
 
-			Debug.Log("(Burst) Radix: " + time + " ticks");
+			Debug.Log("(Burst) Radix: " + time + " ticks" + sample.Report(radixIterations));
 		}
 
 		if (gccEnabled && radixEnabled) {
@@ -1818,12 +3104,17 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Run();
 
+			sample.Begin(true);
 			stopwatch.Restart();
 			benchmark.Run();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
+
+			Debug.Log("(GCC) Radix: " + time + " ticks" + sample.Report(radixIterations));
 
-			Debug.Log("(GCC) Radix: " + time + " ticks");
+			if (histogramsEnabled)
+				Debug.Log(HistogramReport("(GCC) Radix"));
 		}
 
 		if (monoEnabled && radixEnabled) {
@@ -1834,13 +3125,167 @@ public class Benchmarks : JobComponentSystem {
 			stopwatch.Stop();
 			benchmark.Execute();
 
+			sample.Begin(false);
+			stopwatch.Restart();
+			benchmark.Execute();
+
+			time = stopwatch.ElapsedTicks;
+			sample.End();
+
+			Debug.Log("(Mono JIT) Radix: " + time + " ticks" + sample.Report(radixIterations));
+		}
+
+		if (burstEnabled && sgemmEnabled) {
+			var benchmark = new SgemmBurst {
+				size = 256,
+				iterations = sgemmIterations
+			};
+
+			stopwatch.Stop();
+			benchmark.Run();
+
+			sample.Begin(false);
+			stopwatch.Restart();
+			benchmark.Run();
+
+			time = stopwatch.ElapsedTicks;
+			sample.End();
+
+			Debug.Log("(Burst) SGEMM: " + time + " ticks" + sample.Report(sgemmIterations));
+		}
+
+		if (gccEnabled && sgemmEnabled) {
+			var benchmark = new SgemmGCC {
+				size = 256,
+				iterations = sgemmIterations
+			};
+
+			stopwatch.Stop();
+			benchmark.Run();
+
+			sample.Begin(true);
+			stopwatch.Restart();
+			benchmark.Run();
+
+			time = stopwatch.ElapsedTicks;
+			sample.End();
+
+			Debug.Log("(GCC) SGEMM: " + time + " ticks" + sample.Report(sgemmIterations));
+
+			if (histogramsEnabled)
+				Debug.Log(HistogramReport("(GCC) SGEMM"));
+		}
+
+		if (monoEnabled && sgemmEnabled) {
+			var benchmark = new SgemmBurst {
+				size = 256,
+				iterations = sgemmIterations
+			};
+
+			stopwatch.Stop();
+			benchmark.Execute();
+
+			sample.Begin(false);
 			stopwatch.Restart();
 			benchmark.Execute();
 
 			time = stopwatch.ElapsedTicks;
+			sample.End();
+
+			Debug.Log("(Mono JIT) SGEMM: " + time + " ticks" + sample.Report(sgemmIterations));
+		}
+
+		if (gccEnabled && (batchEnabled || storeEnabled || throughputEnabled)) {
+			var names = new System.Collections.Generic.List<string>();
+			var runs = new System.Collections.Generic.List<BatchRun>();
+
+			if (fibonacciEnabled) {
+				names.Add("Fibonacci");
+				runs.Add(new BatchRun(BatchKernel.Fibonacci, batchRepeat, fibonacciNumber));
+			}
+
+			if (mandelbrotEnabled) {
+				names.Add("Mandelbrot");
+				runs.Add(new BatchRun(BatchKernel.Mandelbrot, batchRepeat, 1920, 1080, mandelbrotIterations));
+			}
+
+			if (nbodyEnabled) {
+				names.Add("NBody");
+				runs.Add(new BatchRun(BatchKernel.NBody, batchRepeat, nbodyAdvancements));
+			}
+
+			if (sieveOfEratosthenesEnabled) {
+				names.Add("Sieve of Eratosthenes");
+				runs.Add(new BatchRun(BatchKernel.SieveOfEratosthenes, batchRepeat, sieveOfEratosthenesIterations));
+			}
+
+			if (pixarRaytracerEnabled) {
+				names.Add("Pixar Raytracer");
+				runs.Add(new BatchRun(BatchKernel.PixarRaytracer, batchRepeat, 720, 480, pixarRaytracerSamples));
+			}
+
+			if (firefliesFlockingEnabled) {
+				names.Add("Fireflies Flocking");
+				runs.Add(new BatchRun(BatchKernel.FirefliesFlocking, batchRepeat, 1000, firefliesFlockingLifetime));
+			}
+
+			if (polynomialsEnabled) {
+				names.Add("Polynomials");
+				runs.Add(new BatchRun(BatchKernel.Polynomials, batchRepeat, polynomialsIterations));
+			}
+
+			if (particleKinematicsEnabled) {
+				names.Add("Particle Kinematics");
+				runs.Add(new BatchRun(BatchKernel.ParticleKinematics, batchRepeat, 1000, particleKinematicsIterations));
+			}
+
+			if (arcfourEnabled) {
+				names.Add("Arcfour");
+				runs.Add(new BatchRun(BatchKernel.Arcfour, batchRepeat, arcfourIterations));
+			}
+
+			if (seahashEnabled) {
+				names.Add("Seahash");
+				runs.Add(new BatchRun(BatchKernel.Seahash, batchRepeat, seahashIterations));
+			}
 
-			Debug.Log("(Mono JIT) Radix: " + time + " ticks");
+			if (radixEnabled) {
+				names.Add("Radix");
+				runs.Add(new BatchRun(BatchKernel.Radix, batchRepeat, radixIterations));
+			}
+
+			if (sgemmEnabled) {
+				names.Add("SGEMM");
+				runs.Add(new BatchRun(BatchKernel.Sgemm, batchRepeat, 256, sgemmIterations));
+			}
+
+			if (batchEnabled)
+				Batch(names.ToArray(), runs.ToArray());
+
+			if (storeEnabled)
+				Store(storeDirectory, storeSamples, names.ToArray(), runs.ToArray());
+
+			if (throughputEnabled)
+				Throughput(names.ToArray(), runs.ToArray(), pinnedProcessor, throughputCopies);
 		}
+
+		if (gccEnabled && specializedEnabled)
+			Specialized(batchRepeat, nbodyAdvancements, sieveOfEratosthenesIterations, polynomialsIterations, arcfourIterations, radixIterations);
+
+		if (gccEnabled && sgemmVariantsEnabled)
+			SgemmVariants(1024, sgemmThreads, pinningEnabled ? pinnedProcessor : -1);
+
+		if (sweepEnabled)
+			Sweep(pinnedProcessor);
+
+		if (latencyEnabled)
+			Latency(pinnedProcessor, latencyMaximumSize, latencyLookahead);
+
+		if (gccEnabled && scanEnabled)
+			Scan(scanIterations, scanBufferLength);
+
+		if (gccEnabled && pixarPacketsEnabled)
+			PixarRaytracerPackets(720, 480, pixarPacketsSamples);
 	}
 
 	protected override JobHandle OnUpdate(JobHandle inputDependencies) {
@@ -1849,18 +3294,129 @@ public class Benchmarks : JobComponentSystem {
 
 	private const string nativeLibrary = "benchmarks";
 
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern int benchmark_runner_processors(int[] processors, int length);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern int benchmark_runner_pin(int processor);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern int benchmark_runner_realtime(int priority);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern int benchmark_runner_lock_memory();
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern int benchmark_runner_governor(int processor, byte[] governor, int length);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern void benchmark_runner_clock(ref RunnerClock clock);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern double benchmark_runner_clock_ratio(ref RunnerClock begin, ref RunnerClock end);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern double benchmark_runner_clock_frequency(ref RunnerClock begin, ref RunnerClock end);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern IntPtr benchmark_runner_compiler();
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern IntPtr benchmark_runner_flags();
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern IntPtr benchmark_runner_isa();
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern double benchmark_runner_energy();
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern void benchmark_runner_usage_reset();
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern void benchmark_runner_usage(ref RunnerUsage usage);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern void benchmark_memory_reset();
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern void benchmark_memory_statistics(ref MemoryStatistics statistics);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern void benchmark_memory_stack_paint(uint size);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern ulong benchmark_memory_stack_usage();
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern void benchmark_histogram_reset();
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern void benchmark_histogram_summary(ref HistogramSummary summary, double outlierFactor);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern void benchmark_phases_reset();
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern int benchmark_phases_count();
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern IntPtr benchmark_phase_name(int phase);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern ulong benchmark_phase_cycles(int phase);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern ulong benchmark_phase_calls(int phase);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern ulong benchmark_runner_cache_size(int processor, int level);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern int benchmark_runner_core(int processor);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern double benchmark_latency(ulong size, uint chains, uint lookahead, int hugePages, ulong loads);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern uint benchmark_scan_vector_width();
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern ulong benchmark_scan(uint kernel, int vectorized, uint iterations, uint bufferLength);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern uint benchmark_pixar_raytracer_packet_width();
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern float benchmark_pixar_raytracer_packet(uint width, uint height, uint samples, int vectorized, byte[] firstHits, ulong[] statistics);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern int benchmark_specialized_available();
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern int benchmark_batch([In] BatchRun[] runs, [Out] BatchResult[] results, int count);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern ulong benchmark_throughput([In] BatchRun[] runs, [In] int[] processors, [Out] BatchResult[] results, int copies);
+
 	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
 	private static extern uint benchmark_fibonacci(uint number);
 
 	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
 	private static extern float benchmark_mandelbrot(uint width, uint height, uint iterations);
 
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern ulong benchmark_mandelbrot_optimized(uint width, uint height, uint iterations, uint mode, ref MandelbrotView view, ref MandelbrotStatistics statistics);
+
 	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
 	private static extern double benchmark_nbody(uint advancements);
 
 	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
 	private static extern uint benchmark_sieve_of_eratosthenes(uint iterations);
 
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern uint benchmark_sieve_of_eratosthenes_sized(uint iterations, uint size);
+
 	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
 	private static extern float benchmark_pixar_raytracer(uint width, uint height, uint samples);
 
@@ -1879,6 +3435,21 @@ public class Benchmarks : JobComponentSystem {
 	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
 	private static extern ulong benchmark_seahash(uint iterations);
 
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern ulong benchmark_seahash_sized(uint iterations, uint bufferLength);
+
 	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
 	private static extern int benchmark_radix(uint iterations);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern int benchmark_radix_sized(uint iterations, uint arrayLength);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern float benchmark_sgemm(uint size, uint iterations);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern float benchmark_sgemm_variant(uint size, uint iterations, uint variant, uint threads, [In] int[] processors);
+
+	[DllImport(nativeLibrary, CallingConvention = CallingConvention.Cdecl)]
+	private static extern uint benchmark_sgemm_vector_width();
 }
\ No newline at end of file
@@ -1,13 +1,53 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+	#define _GNU_SOURCE
+#endif
+
 #include <stdlib.h>
 #include <stdint.h>
+#include <stdio.h>
+#include <string.h>
 #include <math.h>
 #include <mm_malloc.h>
 
-#define MALLOC(size, alignment) _mm_malloc(size, alignment)
-#define FREE(pointer) _mm_free(pointer)
+#ifdef _MSC_VER
+	#include <intrin.h>
+#else
+	#include <x86intrin.h>
+#endif
+
+#ifdef _WIN32
+	#include <windows.h>
+#endif
+
+#ifdef __linux__
+	#include <dirent.h>
+	#include <fcntl.h>
+	#include <pthread.h>
+	#include <sched.h>
+	#include <time.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+	#include <sys/resource.h>
+#endif
 
 #ifdef _WIN32
+	#include <psapi.h>
+#endif
+
+#ifdef BENCHMARK_MEMORY
+	#define MALLOC(size, alignment) benchmark_memory_allocate(size, alignment)
+	#define FREE(pointer) benchmark_memory_free(pointer)
+#else
+	#define MALLOC(size, alignment) _mm_malloc(size, alignment)
+	#define FREE(pointer) _mm_free(pointer)
+#endif
+
+#if defined(_WIN32) && defined(__cplusplus)
+	#define EXPORT extern "C" __declspec(dllexport)
+#elif defined(_WIN32)
 	#define EXPORT __declspec(dllexport)
+#elif defined(__cplusplus)
+	#define EXPORT extern "C"
 #else
 	#define EXPORT extern
 #endif
@@ -24,983 +64,4436 @@
 	#define ALLOCA(type, name, length) type name[length]
 #endif
 
-// Fibonacci
-
-EXPORT uint32_t benchmark_fibonacci(uint32_t number) {
-	if (number <= 1)
-		return 1;
-
-	return benchmark_fibonacci(number - 1) + benchmark_fibonacci(number - 2);
-}
-
-// Mandelbrot
-
-EXPORT float benchmark_mandelbrot(uint32_t width, uint32_t height, uint32_t iterations) {
-	float data = 0.0f;
+#ifdef _MSC_VER
+	#define THREAD_LOCAL __declspec(thread)
+	#define STACK_ALLOCATE(size) _alloca(size)
+	#define STACK_FRAME() ((uint8_t*)_AddressOfReturnAddress())
+#else
+	#define THREAD_LOCAL __thread
+	#define STACK_ALLOCATE(size) __builtin_alloca(size)
+	#define STACK_FRAME() ((uint8_t*)__builtin_frame_address(0))
+#endif
 
-	for (uint32_t i = 0; i < iterations; i++) {
-		float
-			left = -2.1f,
-			right = 1.0f,
-			top = -1.3f,
-			bottom = 1.3f,
-			deltaX = (right - left) / width,
-			deltaY = (bottom - top) / height,
-			coordinateX = left;
+#ifdef BENCHMARK_HISTOGRAMS
+	#define HISTOGRAM_BEGIN() uint64_t histogramBegin = benchmark_histogram_timestamp_begin()
+	#define HISTOGRAM_END() benchmark_histogram_record(benchmark_histogram_timestamp_end() - histogramBegin)
+#else
+	#define HISTOGRAM_BEGIN()
+	#define HISTOGRAM_END()
+#endif
 
-		for (uint32_t x = 0; x < width; x++) {
-			float coordinateY = top;
+#ifdef BENCHMARK_PHASES
+	#define PHASE_BEGIN(phase) benchmark_phase_begin(phase)
+	#define PHASE_END() benchmark_phase_end()
+#else
+	#define PHASE_BEGIN(phase)
+	#define PHASE_END()
+#endif
 
-			for (uint32_t y = 0; y < height; y++) {
-				float workX = 0;
-				float workY = 0;
-				int counter = 0;
+// Runner
 
-				while (counter < 255 && sqrtf((workX * workX) + (workY * workY)) < 2.0f) {
-					counter++;
+typedef struct _RunnerClock {
+	uint64_t timestamp, nanoseconds, aperf, mperf;
+} RunnerClock;
 
-					float newX = (workX * workX) - (workY * workY) + coordinateX;
+inline static uint64_t benchmark_runner_nanoseconds(void) {
+	#if defined(__linux__)
+		struct timespec time;
 
-					workY = 2 * workX * workY + coordinateY;
-					workX = newX;
-				}
+		clock_gettime(CLOCK_MONOTONIC_RAW, &time);
 
-				data = workX + workY;
-				coordinateY += deltaY;
-			}
+		return (uint64_t)time.tv_sec * 1000000000 + (uint64_t)time.tv_nsec;
+	#elif defined(_WIN32)
+		LARGE_INTEGER counter, frequency;
 
-			coordinateX += deltaX;
-		}
-	}
+		QueryPerformanceCounter(&counter);
+		QueryPerformanceFrequency(&frequency);
 
-	return data;
+		return (uint64_t)((double)counter.QuadPart * 1000000000.0 / (double)frequency.QuadPart);
+	#else
+		return 0;
+	#endif
 }
 
-// NBody
+EXPORT int benchmark_runner_processors(int* processors, int length) {
+	// The mask is captured at the first call so that pinning the calling thread later does not narrow the list
 
-typedef struct _NBody {
-	double x, y, z, vx, vy, vz, mass;
-} NBody;
+	int count = 0;
 
-inline static void benchmark_nbody_initialize_bodies(NBody* sun, NBody* end) {
-	const double pi = 3.141592653589793;
-	const double solarMass = 4 * pi * pi;
-	const double daysPerYear = 365.24;
+	#if defined(__linux__)
+		static cpu_set_t allowed;
+		static int captured = 0;
 
-	sun[1] = STRUCT_INIT(NBody) { // Jupiter
-		4.84143144246472090e+00,
-		-1.16032004402742839e+00,
-		-1.03622044471123109e-01,
-		1.66007664274403694e-03 * daysPerYear,
-		7.69901118419740425e-03 * daysPerYear,
-		-6.90460016972063023e-05 * daysPerYear,
-		9.54791938424326609e-04 * solarMass
-	};
+		if (!captured) {
+			if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+				return 0;
 
-	sun[2] = STRUCT_INIT(NBody) { // Saturn
-		8.34336671824457987e+00,
-		4.12479856412430479e+00,
-		-4.03523417114321381e-01,
-		-2.76742510726862411e-03 * daysPerYear,
-		4.99852801234917238e-03 * daysPerYear,
-		2.30417297573763929e-05 * daysPerYear,
-		2.85885980666130812e-04 * solarMass
-	};
+			captured = 1;
+		}
 
-	sun[3] = STRUCT_INIT(NBody) { // Uranus
-		1.28943695621391310e+01,
-		-1.51111514016986312e+01,
-		-2.23307578892655734e-01,
-		2.96460137564761618e-03 * daysPerYear,
-		2.37847173959480950e-03 * daysPerYear,
-		-2.96589568540237556e-05 * daysPerYear,
-		4.36624404335156298e-05 * solarMass
-	};
+		for (int i = 0; i < CPU_SETSIZE; i++) {
+			if (CPU_ISSET(i, &allowed)) {
+				if (count < length)
+					processors[count] = i;
 
-	sun[4] = STRUCT_INIT(NBody) { // Neptune
-		1.53796971148509165e+01,
-		-2.59193146099879641e+01,
-		1.79258772950371181e-01,
-		2.68067772490389322e-03 * daysPerYear,
-		1.62824170038242295e-03 * daysPerYear,
-		-9.51592254519715870e-05 * daysPerYear,
-		5.15138902046611451e-05 * solarMass
-	};
+				count++;
+			}
+		}
+	#elif defined(_WIN32)
+		DWORD_PTR process, system;
 
-	double vx = 0, vy = 0, vz = 0;
+		if (!GetProcessAffinityMask(GetCurrentProcess(), &process, &system))
+			return 0;
 
-	for (NBody* planet = sun + 1; planet <= end; ++planet) {
-		double mass = planet->mass;
+		for (int i = 0; i < (int)(sizeof(DWORD_PTR) * 8); i++) {
+			if (process & ((DWORD_PTR)1 << i)) {
+				if (count < length)
+					processors[count] = i;
 
-		vx += planet->vx * mass;
-		vy += planet->vy * mass;
-		vz += planet->vz * mass;
-	}
+				count++;
+			}
+		}
+	#endif
 
-	sun->mass = solarMass;
-	sun->vx = vx / -solarMass;
-	sun->vy = vy / -solarMass;
-	sun->vz = vz / -solarMass;
+	return count;
 }
 
-inline static void benchmark_nbody_energy(NBody* sun, NBody* end) {
-	double e = 0.0;
+EXPORT int benchmark_runner_pin(int processor) {
+	#if defined(__linux__)
+		cpu_set_t set;
 
-	for (NBody* bi = sun; bi <= end; ++bi) {
-		double
-			imass = bi->mass,
-			ix = bi->x,
-			iy = bi->y,
-			iz = bi->z,
-			ivx = bi->vx,
-			ivy = bi->vy,
-			ivz = bi->vz;
+		if (processor < 0 || processor >= CPU_SETSIZE)
+			return 0;
 
-		e += 0.5 * imass * (ivx * ivx + ivy * ivy + ivz * ivz);
+		CPU_ZERO(&set);
+		CPU_SET(processor, &set);
 
-		for (NBody* bj = bi + 1; bj <= end; ++bj) {
-			double
-				jmass = bj->mass,
-				dx = ix - bj->x,
-				dy = iy - bj->y,
-				dz = iz - bj->z;
+		return sched_setaffinity(0, sizeof(set), &set) == 0;
+	#elif defined(_WIN32)
+		if (processor < 0 || processor >= (int)(sizeof(DWORD_PTR) * 8))
+			return 0;
 
-			e -= imass * jmass / sqrt(dx * dx + dy * dy + dz * dz);
-		}
-	}
+		return SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << processor) != 0;
+	#else
+		return 0;
+	#endif
 }
 
-inline static double benchmark_nbody_get_d2(double dx, double dy, double dz) {
-	double d2 = dx * dx + dy * dy + dz * dz;
+EXPORT int benchmark_runner_realtime(int priority) {
+	#if defined(__linux__)
+		struct sched_param parameters = { 0 };
 
-	return d2 * sqrt(d2);
+		parameters.sched_priority = priority;
+
+		return sched_setscheduler(0, SCHED_FIFO, &parameters) == 0;
+	#elif defined(_WIN32)
+		return SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL) != 0;
+	#else
+		return 0;
+	#endif
 }
 
-inline static void benchmark_nbody_advance(NBody* sun, NBody* end, double distance) {
-	for (NBody* bi = sun; bi < end; ++bi) {
-		double
-			ix = bi->x,
-			iy = bi->y,
-			iz = bi->z,
-			ivx = bi->vx,
-			ivy = bi->vy,
-			ivz = bi->vz,
-			imass = bi->mass;
+EXPORT int benchmark_runner_lock_memory(void) {
+	#if defined(__linux__)
+		return mlockall(MCL_CURRENT | MCL_FUTURE) == 0;
+	#else
+		return 0;
+	#endif
+}
 
-		for (NBody* bj = bi + 1; bj <= end; ++bj) {
-			double
-				dx = bj->x - ix,
-				dy = bj->y - iy,
-				dz = bj->z - iz,
-				jmass = bj->mass,
-				mag = distance / benchmark_nbody_get_d2(dx, dy, dz);
+// Returns 1 for the performance governor, 0 for any other, and -1 if cpufreq is not exposed
 
-			bj->vx = bj->vx - dx * imass * mag;
-			bj->vy = bj->vy - dy * imass * mag;
-			bj->vz = bj->vz - dz * imass * mag;
-			ivx = ivx + dx * jmass * mag;
-			ivy = ivy + dy * jmass * mag;
-			ivz = ivz + dz * jmass * mag;
-		}
+EXPORT int benchmark_runner_governor(int processor, char* governor, int length) {
+	if (length > 0)
+		governor[0] = 0;
 
-		bi->vx = ivx;
-		bi->vy = ivy;
-		bi->vz = ivz;
-		bi->x = ix + ivx * distance;
-		bi->y = iy + ivy * distance;
-		bi->z = iz + ivz * distance;
-	}
+	#if defined(__linux__)
+		char path[64];
 
-	end->x = end->x + end->vx * distance;
-	end->y = end->y + end->vy * distance;
-	end->z = end->z + end->vz * distance;
-}
+		snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cpufreq/scaling_governor", processor);
 
-EXPORT double benchmark_nbody(uint32_t advancements) {
-	NBody sun[5] = { 0 };
-	NBody* end = sun + 4;
+		FILE* file = fopen(path, "r");
 
-	benchmark_nbody_initialize_bodies(sun, end);
-	benchmark_nbody_energy(sun, end);
+		if (file == NULL)
+			return -1;
 
-	while (--advancements > 0) {
-		benchmark_nbody_advance(sun, end, 0.01);
-	}
+		int read = fgets(governor, length, file) != NULL;
 
-	benchmark_nbody_energy(sun, end);
+		fclose(file);
 
-	return sun[0].x + sun[0].y;
-}
+		if (!read)
+			return -1;
 
-// Sieve of Eratosthenes
+		governor[strcspn(governor, "\r\n")] = 0;
 
-EXPORT uint32_t benchmark_sieve_of_eratosthenes(uint32_t iterations) {
-	const int size = 1024;
+		return strcmp(governor, "performance") == 0;
+	#else
+		(void)processor;
 
-	uint8_t flags[size];
-	uint32_t a, b, c, prime, count = 0;
+		return -1;
+	#endif
+}
 
-	for (a = 1; a <= iterations; a++) {
-		count = 0;
+// APERF and MPERF are read through the msr driver and stay zero when it is not accessible
 
-		for (b = 0; b < size; b++) {
-			flags[b] = 1; // True
-		}
+EXPORT void benchmark_runner_clock(RunnerClock* clock) {
+	clock->aperf = 0;
+	clock->mperf = 0;
 
-		for (b = 0; b < size; b++) {
-			if (flags[b] == 1) {
-				prime = b + b + 3;
-				c = b + prime;
+	#if defined(__linux__)
+		char path[32];
 
-				while (c < size) {
-					flags[c] = 0; // False
-					c += prime;
-				}
+		snprintf(path, sizeof(path), "/dev/cpu/%d/msr", sched_getcpu());
 
-				count++;
+		int msr = open(path, O_RDONLY);
+
+		if (msr >= 0) {
+			if (pread(msr, &clock->mperf, sizeof(uint64_t), 0xE7) != sizeof(uint64_t) || pread(msr, &clock->aperf, sizeof(uint64_t), 0xE8) != sizeof(uint64_t)) {
+				clock->aperf = 0;
+				clock->mperf = 0;
 			}
+
+			close(msr);
 		}
-	}
+	#endif
 
-	return count;
+	clock->nanoseconds = benchmark_runner_nanoseconds();
+	clock->timestamp = __rdtsc();
 }
 
-// Pixar Raytracer
+// Average APERF/MPERF ratio between two samples: below 1.0 the core was throttled, above 1.0 it was boosting
 
-typedef struct _Vector {
-	float x, y, z;
-} Vector;
+EXPORT double benchmark_runner_clock_ratio(const RunnerClock* begin, const RunnerClock* end) {
+	uint64_t mperf = end->mperf - begin->mperf;
 
-typedef enum _PixarRayHit {
-	PIXAR_RAYTRACER_NONE = 0,
-	PIXAR_RAYTRACER_LETTER = 1,
-	PIXAR_RAYTRACER_WALL = 2,
-	PIXAR_RAYTRACER_SUN = 3
-} PixarRayHit;
+	if (begin->mperf == 0 || end->mperf == 0 || mperf == 0)
+		return 0.0;
 
-static uint32_t marsagliaZ, marsagliaW;
+	return (double)(end->aperf - begin->aperf) / (double)mperf;
+}
 
-inline static Vector benchmark_pixar_raytracer_multiply(Vector left, Vector right) {
-	left.x *= right.x;
-	left.y *= right.y;
-	left.z *= right.z;
+// Effective frequency in megahertz, the TSC rate is used as is when APERF/MPERF are unavailable
 
-	return left;
-}
+EXPORT double benchmark_runner_clock_frequency(const RunnerClock* begin, const RunnerClock* end) {
+	uint64_t nanoseconds = end->nanoseconds - begin->nanoseconds;
 
-inline static Vector benchmark_pixar_raytracer_multiply_float(Vector vector, float value) {
-	vector.x *= value;
-	vector.y *= value;
-	vector.z *= value;
+	if (nanoseconds == 0)
+		return 0.0;
 
-	return vector;
-}
+	double frequency = (double)(end->timestamp - begin->timestamp) * 1000.0 / (double)nanoseconds;
+	double ratio = benchmark_runner_clock_ratio(begin, end);
 
-inline static float benchmark_pixar_raytracer_modulus(Vector left, Vector right) {
-	return left.x * right.x + left.y * right.y + left.z * right.z;
+	return ratio > 0.0 ? frequency * ratio : frequency;
 }
 
-inline static float benchmark_pixar_raytracer_modulus_self(Vector vector) {
-	return vector.x * vector.x + vector.y * vector.y + vector.z * vector.z;
-}
+// Size in bytes of the data or unified cache at the given level, 0 if it is not reported
 
-inline static Vector benchmark_pixar_raytracer_inverse(Vector vector) {
-	return benchmark_pixar_raytracer_multiply_float(vector, 1 / sqrtf(benchmark_pixar_raytracer_modulus_self(vector)));
-}
+EXPORT uint64_t benchmark_runner_cache_size(int processor, int level) {
+	#if defined(__linux__)
+		for (int index = 0; index < 16; index++) {
+			char path[96], type[32];
+			unsigned long size = 0;
+			int cacheLevel = 0;
+			char unit = 0;
 
-inline static Vector benchmark_pixar_raytracer_add(Vector left, Vector right) {
-	left.x += right.x;
-	left.y += right.y;
+			snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cache/index%d/level", processor, index);
+
+			FILE* file = fopen(path, "r");
+
+			if (file == NULL)
+				break;
+
+			int read = fscanf(file, "%d", &cacheLevel) == 1;
+
+			fclose(file);
+
+			if (!read || cacheLevel != level)
+				continue;
+
+			snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cache/index%d/type", processor, index);
+
+			if ((file = fopen(path, "r")) == NULL)
+				continue;
+
+			read = fscanf(file, "%31s", type) == 1;
+
+			fclose(file);
+
+			if (!read || strcmp(type, "Instruction") == 0)
+				continue;
+
+			snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cache/index%d/size", processor, index);
+
+			if ((file = fopen(path, "r")) == NULL)
+				continue;
+
+			read = fscanf(file, "%lu%c", &size, &unit) >= 1;
+
+			fclose(file);
+
+			if (!read)
+				continue;
+
+			switch (unit) {
+				case 'K': return (uint64_t)size << 10;
+				case 'M': return (uint64_t)size << 20;
+				case 'G': return (uint64_t)size << 30;
+				default: return (uint64_t)size;
+			}
+		}
+
+		return 0;
+	#elif defined(_WIN32)
+		SYSTEM_LOGICAL_PROCESSOR_INFORMATION information[256];
+		DWORD length = sizeof(information);
+
+		(void)processor;
+
+		if (!GetLogicalProcessorInformation(information, &length))
+			return 0;
+
+		for (DWORD i = 0; i < length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION); i++) {
+			if (information[i].Relationship == RelationCache && information[i].Cache.Level == level && information[i].Cache.Type != CacheInstruction)
+				return information[i].Cache.Size;
+		}
+
+		return 0;
+	#else
+		(void)processor;
+		(void)level;
+
+		return 0;
+	#endif
+}
+
+// Identifier shared by the logical processors of one physical core, so SMT siblings compare equal, -1 if the topology is not reported
+
+EXPORT int benchmark_runner_core(int processor) {
+	#if defined(__linux__)
+		char path[96];
+		int core = -1, package = 0;
+
+		snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/core_id", processor);
+
+		FILE* file = fopen(path, "r");
+
+		if (file == NULL)
+			return -1;
+
+		int read = fscanf(file, "%d", &core) == 1;
+
+		fclose(file);
+
+		if (!read)
+			return -1;
+
+		snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/physical_package_id", processor);
+
+		if ((file = fopen(path, "r")) != NULL) {
+			if (fscanf(file, "%d", &package) != 1)
+				package = 0;
+
+			fclose(file);
+		}
+
+		return (package << 16) | core;
+	#elif defined(_WIN32)
+		SYSTEM_LOGICAL_PROCESSOR_INFORMATION information[256];
+		DWORD length = sizeof(information);
+
+		if (processor < 0 || processor >= (int)(sizeof(ULONG_PTR) * 8) || !GetLogicalProcessorInformation(information, &length))
+			return -1;
+
+		for (DWORD i = 0; i < length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION); i++) {
+			if (information[i].Relationship == RelationProcessorCore && (information[i].ProcessorMask >> processor) & 1)
+				return (int)i;
+		}
+
+		return -1;
+	#else
+		(void)processor;
+
+		return -1;
+	#endif
+}
+
+// Build identification attached to stored results, the flags are not visible to the preprocessor and are passed in as BENCHMARK_FLAGS="\"...\""
+
+#ifndef BENCHMARK_FLAGS
+	#define BENCHMARK_FLAGS "unspecified"
+#endif
+
+#define RUNNER_STRING(value) #value
+#define RUNNER_VERSION(value) RUNNER_STRING(value)
+
+EXPORT const char* benchmark_runner_compiler(void) {
+	#if defined(__clang__)
+		return "Clang " __clang_version__;
+	#elif defined(__GNUC__)
+		return "GCC " __VERSION__;
+	#elif defined(_MSC_VER)
+		return "MSVC " RUNNER_VERSION(_MSC_FULL_VER);
+	#else
+		return "unknown";
+	#endif
+}
+
+EXPORT const char* benchmark_runner_flags(void) {
+	return BENCHMARK_FLAGS;
+}
+
+// Highest instruction set the compiler was allowed to target, not what the processor supports
+
+EXPORT const char* benchmark_runner_isa(void) {
+	#if defined(__AVX512F__)
+		return "AVX-512";
+	#elif defined(__AVX2__)
+		return "AVX2";
+	#elif defined(__AVX__)
+		return "AVX";
+	#elif defined(__SSE4_2__)
+		return "SSE4.2";
+	#elif defined(__SSE2__) || defined(_M_X64)
+		return "SSE2";
+	#else
+		return "baseline";
+	#endif
+}
+
+// Energy
+
+#define RUNNER_ENERGY_DOMAINS 16
+
+#ifndef RUNNER_POWERCAP_PATH
+	#define RUNNER_POWERCAP_PATH "/sys/class/powercap"
+#endif
+
+static int energyDomains = -1;
+static char energyPaths[RUNNER_ENERGY_DOMAINS][64];
+static uint64_t energyRanges[RUNNER_ENERGY_DOMAINS], energyLast[RUNNER_ENERGY_DOMAINS];
+static double energyTotal;
+
+#ifdef __linux__
+	static int benchmark_runner_energy_read(const char* domain, const char* counter, uint64_t* value) {
+		char path[128];
+
+		snprintf(path, sizeof(path), RUNNER_POWERCAP_PATH "/%s/%s", domain, counter);
+
+		FILE* file = fopen(path, "r");
+
+		if (file == NULL)
+			return 0;
+
+		unsigned long long microjoules = 0;
+		int read = fscanf(file, "%llu", &microjoules) == 1;
+
+		fclose(file);
+
+		*value = microjoules;
+
+		return read;
+	}
+
+	static int benchmark_runner_energy_package(const char* domain) {
+		char path[128];
+		char name[32] = { 0 };
+
+		snprintf(path, sizeof(path), RUNNER_POWERCAP_PATH "/%s/name", domain);
+
+		FILE* file = fopen(path, "r");
+
+		if (file == NULL)
+			return 0;
+
+		int read = fgets(name, sizeof(name), file) != NULL;
+
+		fclose(file);
+
+		return read && strncmp(name, "package-", 8) == 0;
+	}
+
+	static void benchmark_runner_energy_discover(void) {
+		DIR* directory = opendir(RUNNER_POWERCAP_PATH);
+
+		energyDomains = 0;
+
+		if (directory == NULL)
+			return;
+
+		struct dirent* entry;
+
+		while ((entry = readdir(directory)) != NULL && energyDomains < RUNNER_ENERGY_DOMAINS) {
+			const char* name = entry->d_name;
+			const char* zone = NULL;
+
+			if (strncmp(name, "intel-rapl:", 11) == 0)
+				zone = name + 11;
+			else if (strncmp(name, "amd-rapl:", 9) == 0)
+				zone = name + 9;
+
+			// Only top-level package zones, their subzones (core, uncore, dram) are already included and top-level psys or dram zones would count the package twice
+
+			if (zone == NULL || strchr(zone, ':') != NULL || strlen(name) >= sizeof(energyPaths[0]) || !benchmark_runner_energy_package(name))
+				continue;
+
+			strcpy(energyPaths[energyDomains], name);
+
+			if (benchmark_runner_energy_read(name, "max_energy_range_uj", &energyRanges[energyDomains]) && benchmark_runner_energy_read(name, "energy_uj", &energyLast[energyDomains]))
+				energyDomains++;
+		}
+
+		closedir(directory);
+	}
+#endif
+
+// Cumulative package energy in joules since the first call, or a negative value if RAPL is not available or readable
+
+EXPORT double benchmark_runner_energy(void) {
+	#ifdef __linux__
+		if (energyDomains < 0)
+			benchmark_runner_energy_discover();
+
+		if (energyDomains == 0)
+			return -1.0;
+
+		for (int i = 0; i < energyDomains; i++) {
+			uint64_t value = 0;
+
+			if (!benchmark_runner_energy_read(energyPaths[i], "energy_uj", &value))
+				return -1.0;
+
+			if (value >= energyLast[i])
+				energyTotal += (double)(value - energyLast[i]);
+			else
+				energyTotal += (double)(energyRanges[i] - energyLast[i] + value);
+
+			energyLast[i] = value;
+		}
+
+		return energyTotal / 1000000.0;
+	#else
+		return -1.0;
+	#endif
+}
+
+// Memory
+
+#define MEMORY_HEADER_SIZE 16
+#define MEMORY_STACK_PATTERN 0xA5
+
+typedef struct _MemoryStatistics {
+	uint64_t tracked, allocations, frees, bytes, peak;
+} MemoryStatistics;
+
+typedef struct _RunnerUsage {
+	uint64_t resident, peakResident, minorFaults, majorFaults;
+} RunnerUsage;
+
+static THREAD_LOCAL uint64_t memoryAllocations, memoryFrees, memoryBytes, memoryLive, memoryPeak;
+static THREAD_LOCAL uint8_t* memoryStackTop;
+static THREAD_LOCAL uint8_t* memoryStackBottom;
+
+// The requested size and the header length are stored in front of every block, so frees can be accounted without a lookup
+
+inline static void* benchmark_memory_allocate(size_t size, size_t alignment) {
+	size_t header = alignment < MEMORY_HEADER_SIZE ? MEMORY_HEADER_SIZE : alignment;
+	uint8_t* pointer = (uint8_t*)_mm_malloc(size + header, header) + header;
+
+	((uint64_t*)pointer)[-1] = size;
+	((uint64_t*)pointer)[-2] = header;
+
+	memoryAllocations++;
+	memoryBytes += size;
+	memoryLive += size;
+
+	if (memoryLive > memoryPeak)
+		memoryPeak = memoryLive;
+
+	return pointer;
+}
+
+inline static void benchmark_memory_free(void* pointer) {
+	uint64_t size = ((uint64_t*)pointer)[-1];
+	uint64_t header = ((uint64_t*)pointer)[-2];
+
+	memoryFrees++;
+	memoryLive -= size;
+
+	_mm_free((uint8_t*)pointer - header);
+}
+
+EXPORT void benchmark_memory_reset(void) {
+	memoryAllocations = 0;
+	memoryFrees = 0;
+	memoryBytes = 0;
+	memoryPeak = memoryLive;
+}
+
+EXPORT void benchmark_memory_statistics(MemoryStatistics* statistics) {
+	#ifdef BENCHMARK_MEMORY
+		statistics->tracked = 1;
+	#else
+		statistics->tracked = 0;
+	#endif
+
+	statistics->allocations = memoryAllocations;
+	statistics->frees = memoryFrees;
+	statistics->bytes = memoryBytes;
+	statistics->peak = memoryPeak;
+}
+
+// Fills the given amount of stack below the caller with a pattern, a kernel called next from the same frame overwrites it as deep as it goes
+
+EXPORT void benchmark_memory_stack_paint(uint32_t size) {
+	volatile uint8_t* region = (volatile uint8_t*)STACK_ALLOCATE(size);
+
+	for (uint32_t i = 0; i < size; i++) {
+		region[i] = MEMORY_STACK_PATTERN;
+	}
+
+	memoryStackTop = STACK_FRAME();
+	memoryStackBottom = (uint8_t*)region;
+}
+
+// Stack high-water mark in bytes since the last paint, equal to the painted size if the kernel went beyond it
+
+EXPORT uint64_t benchmark_memory_stack_usage(void) {
+	volatile uint8_t* position = memoryStackBottom;
+
+	if (position == NULL)
+		return 0;
+
+	while (position < memoryStackTop && *position == MEMORY_STACK_PATTERN) {
+		position++;
+	}
+
+	return (uint64_t)(memoryStackTop - position);
+}
+
+// Resets the peak resident set when the platform allows it, so the next sample reports the peak of a single run
+
+EXPORT void benchmark_runner_usage_reset(void) {
+	#if defined(__linux__)
+		FILE* file = fopen("/proc/self/clear_refs", "w");
+
+		if (file != NULL) {
+			fputs("5", file);
+			fclose(file);
+		}
+	#endif
+}
+
+EXPORT void benchmark_runner_usage(RunnerUsage* usage) {
+	memset(usage, 0, sizeof(RunnerUsage));
+
+	#if defined(__linux__)
+		struct rusage resources;
+		unsigned long pages = 0, resident = 0;
+		FILE* file = fopen("/proc/self/statm", "r");
+
+		if (file != NULL) {
+			if (fscanf(file, "%lu %lu", &pages, &resident) == 2)
+				usage->resident = (uint64_t)resident * (uint64_t)sysconf(_SC_PAGESIZE);
+
+			fclose(file);
+		}
+
+		// VmHWM is the peak that clear_refs resets, ru_maxrss keeps the lifetime peak of the process
+
+		file = fopen("/proc/self/status", "r");
+
+		if (file != NULL) {
+			char line[128];
+			unsigned long peak = 0;
+
+			while (fgets(line, sizeof(line), file) != NULL) {
+				if (sscanf(line, "VmHWM: %lu kB", &peak) == 1) {
+					usage->peakResident = (uint64_t)peak * 1024;
+
+					break;
+				}
+			}
+
+			fclose(file);
+		}
+
+		if (getrusage(RUSAGE_SELF, &resources) == 0) {
+			usage->minorFaults = (uint64_t)resources.ru_minflt;
+			usage->majorFaults = (uint64_t)resources.ru_majflt;
+		}
+	#elif defined(_WIN32)
+		PROCESS_MEMORY_COUNTERS counters;
+
+		if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+			usage->resident = counters.WorkingSetSize;
+			usage->peakResident = counters.PeakWorkingSetSize;
+			usage->minorFaults = counters.PageFaultCount;
+		}
+	#endif
+}
+
+// Histogram
+
+#define HISTOGRAM_SUB_BUCKET_BITS 4
+#define HISTOGRAM_SUB_BUCKETS (1 << HISTOGRAM_SUB_BUCKET_BITS)
+#define HISTOGRAM_BUCKETS ((64 - HISTOGRAM_SUB_BUCKET_BITS + 1) * HISTOGRAM_SUB_BUCKETS)
+
+typedef struct _HistogramSummary {
+	uint64_t count, minimum, maximum, outliers;
+	double mean, p50, p90, p99, p999;
+} HistogramSummary;
+
+static THREAD_LOCAL uint64_t histogramBuckets[HISTOGRAM_BUCKETS];
+static THREAD_LOCAL uint64_t histogramCount, histogramMinimum, histogramMaximum, histogramSum;
+
+inline static uint64_t benchmark_histogram_timestamp_begin(void) {
+	_mm_lfence();
+
+	uint64_t timestamp = __rdtsc();
+
+	_mm_lfence();
+
+	return timestamp;
+}
+
+inline static uint64_t benchmark_histogram_timestamp_end(void) {
+	uint32_t processor;
+	uint64_t timestamp = __rdtscp(&processor);
+
+	_mm_lfence();
+
+	return timestamp;
+}
+
+// Log-linear buckets: values below 16 are exact, above that every power of two is split into 16 sub-buckets
+
+inline static int benchmark_histogram_index(uint64_t value) {
+	if (value < HISTOGRAM_SUB_BUCKETS)
+		return (int)value;
+
+	int exponent = 63;
+
+	while (!(value >> exponent))
+		exponent--;
+
+	int shift = exponent - HISTOGRAM_SUB_BUCKET_BITS;
+
+	return (shift + 1) * HISTOGRAM_SUB_BUCKETS + (int)((value >> shift) & (HISTOGRAM_SUB_BUCKETS - 1));
+}
+
+inline static uint64_t benchmark_histogram_value(int index) {
+	if (index < HISTOGRAM_SUB_BUCKETS)
+		return (uint64_t)index;
+
+	int shift = index / HISTOGRAM_SUB_BUCKETS - 1;
+	uint64_t lower = (uint64_t)(HISTOGRAM_SUB_BUCKETS + index % HISTOGRAM_SUB_BUCKETS) << shift;
+
+	return lower + ((uint64_t)1 << shift) - 1;
+}
+
+inline static void benchmark_histogram_record(uint64_t cycles) {
+	histogramBuckets[benchmark_histogram_index(cycles)]++;
+
+	if (histogramCount == 0 || cycles < histogramMinimum)
+		histogramMinimum = cycles;
+
+	if (cycles > histogramMaximum)
+		histogramMaximum = cycles;
+
+	histogramCount++;
+	histogramSum += cycles;
+}
+
+static double benchmark_histogram_percentile(double percentile) {
+	uint64_t target = (uint64_t)ceil(percentile / 100.0 * (double)histogramCount);
+	uint64_t seen = 0;
+
+	if (target == 0)
+		target = 1;
+
+	for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+		seen += histogramBuckets[i];
+
+		if (seen >= target) {
+			uint64_t value = benchmark_histogram_value(i);
+
+			return (double)(value < histogramMaximum ? value : histogramMaximum);
+		}
+	}
+
+	return (double)histogramMaximum;
+}
+
+EXPORT void benchmark_histogram_reset(void) {
+	memset(histogramBuckets, 0, sizeof(histogramBuckets));
+
+	histogramCount = 0;
+	histogramMinimum = 0;
+	histogramMaximum = 0;
+	histogramSum = 0;
+}
+
+// Outliers are iterations that took longer than the given multiple of the median
+
+EXPORT void benchmark_histogram_summary(HistogramSummary* summary, double outlierFactor) {
+	memset(summary, 0, sizeof(HistogramSummary));
+
+	if (histogramCount == 0)
+		return;
+
+	summary->count = histogramCount;
+	summary->minimum = histogramMinimum;
+	summary->maximum = histogramMaximum;
+	summary->mean = (double)histogramSum / (double)histogramCount;
+	summary->p50 = benchmark_histogram_percentile(50.0);
+	summary->p90 = benchmark_histogram_percentile(90.0);
+	summary->p99 = benchmark_histogram_percentile(99.0);
+	summary->p999 = benchmark_histogram_percentile(99.9);
+
+	for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+		if (histogramBuckets[i] > 0 && (double)benchmark_histogram_value(i) > summary->p50 * outlierFactor)
+			summary->outliers += histogramBuckets[i];
+	}
+}
+
+// Phases
+
+#define PHASE_STACK_DEPTH 8
+
+typedef enum _Phase {
+	PHASE_FIREFLIES_FLOCKING_UPDATE,
+	PHASE_FIREFLIES_FLOCKING_SEPARATION,
+	PHASE_FIREFLIES_FLOCKING_COHESION,
+	PHASE_PIXAR_RAYTRACER_BOUNCE,
+	PHASE_PIXAR_RAYTRACER_RAY_MARCHING,
+	PHASE_PIXAR_RAYTRACER_SAMPLE,
+	PHASE_COUNT
+} Phase;
+
+static const char* phaseNames[PHASE_COUNT] = {
+	"fireflies_flocking.update",
+	"fireflies_flocking.separation",
+	"fireflies_flocking.cohesion",
+	"pixar_raytracer.bounce",
+	"pixar_raytracer.ray_marching",
+	"pixar_raytracer.sample"
+};
+
+static THREAD_LOCAL uint64_t phaseCycles[PHASE_COUNT], phaseCalls[PHASE_COUNT];
+static THREAD_LOCAL uint64_t phaseTimestamp;
+static THREAD_LOCAL int phaseStack[PHASE_STACK_DEPTH], phaseDepth;
+
+// Cycles are charged to the innermost open phase only, so nested phases report exclusive time
+
+inline static void benchmark_phase_switch(void) {
+	uint64_t timestamp = __rdtsc();
+
+	if (phaseDepth > 0)
+		phaseCycles[phaseStack[phaseDepth - 1]] += timestamp - phaseTimestamp;
+
+	phaseTimestamp = timestamp;
+}
+
+inline static void benchmark_phase_begin(Phase phase) {
+	benchmark_phase_switch();
+
+	phaseCalls[phase]++;
+	phaseStack[phaseDepth++] = phase;
+}
+
+inline static void benchmark_phase_end(void) {
+	benchmark_phase_switch();
+
+	phaseDepth--;
+}
+
+EXPORT void benchmark_phases_reset(void) {
+	memset(phaseCycles, 0, sizeof(phaseCycles));
+	memset(phaseCalls, 0, sizeof(phaseCalls));
+
+	phaseDepth = 0;
+}
+
+EXPORT int benchmark_phases_count(void) {
+	return PHASE_COUNT;
+}
+
+EXPORT const char* benchmark_phase_name(int phase) {
+	return phase >= 0 && phase < PHASE_COUNT ? phaseNames[phase] : NULL;
+}
+
+EXPORT uint64_t benchmark_phase_cycles(int phase) {
+	return phase >= 0 && phase < PHASE_COUNT ? phaseCycles[phase] : 0;
+}
+
+EXPORT uint64_t benchmark_phase_calls(int phase) {
+	return phase >= 0 && phase < PHASE_COUNT ? phaseCalls[phase] : 0;
+}
+
+// Fibonacci
+
+EXPORT uint32_t benchmark_fibonacci(uint32_t number) {
+	if (number <= 1)
+		return 1;
+
+	return benchmark_fibonacci(number - 1) + benchmark_fibonacci(number - 2);
+}
+
+// Mandelbrot
+
+EXPORT float benchmark_mandelbrot(uint32_t width, uint32_t height, uint32_t iterations) {
+	float data = 0.0f;
+
+	for (uint32_t i = 0; i < iterations; i++) {
+		HISTOGRAM_BEGIN();
+
+		float
+			left = -2.1f,
+			right = 1.0f,
+			top = -1.3f,
+			bottom = 1.3f,
+			deltaX = (right - left) / width,
+			deltaY = (bottom - top) / height,
+			coordinateX = left;
+
+		for (uint32_t x = 0; x < width; x++) {
+			float coordinateY = top;
+
+			for (uint32_t y = 0; y < height; y++) {
+				float workX = 0;
+				float workY = 0;
+				int counter = 0;
+
+				while (counter < 255 && sqrtf((workX * workX) + (workY * workY)) < 2.0f) {
+					counter++;
+
+					float newX = (workX * workX) - (workY * workY) + coordinateX;
+
+					workY = 2 * workX * workY + coordinateY;
+					workX = newX;
+				}
+
+				data = workX + workY;
+				coordinateY += deltaY;
+			}
+
+			coordinateX += deltaX;
+		}
+
+		HISTOGRAM_END();
+	}
+
+	return data;
+}
+
+// Mandelbrot (optimized)
+
+#define MANDELBROT_CARDIOID 1
+#define MANDELBROT_PERIODICITY 2
+#define MANDELBROT_DOUBLE 4
+
+typedef struct _MandelbrotView {
+	double left, right, top, bottom;
+} MandelbrotView;
+
+typedef struct _MandelbrotStatistics {
+	uint64_t iterations, skipped, cardioid, bulb, periodic;
+} MandelbrotStatistics;
+
+// Points inside the main cardioid and the period-2 bulb never escape, and an orbit that exactly revisits a point checked by Brent's doubling schedule is periodic, so both resolve to the iteration limit without changing any count
+
+inline static int benchmark_mandelbrot_pixel_float(float coordinateX, float coordinateY, uint32_t mode, MandelbrotStatistics* statistics) {
+	if (mode & MANDELBROT_CARDIOID) {
+		float shiftedX = coordinateX - 0.25f;
+		float bulbX = coordinateX + 1.0f;
+		float q = shiftedX * shiftedX + coordinateY * coordinateY;
+
+		if (q * (q + shiftedX) <= 0.25f * coordinateY * coordinateY) {
+			statistics->cardioid++;
+			statistics->skipped += 255;
+
+			return 255;
+		}
+
+		if (bulbX * bulbX + coordinateY * coordinateY <= 0.0625f) {
+			statistics->bulb++;
+			statistics->skipped += 255;
+
+			return 255;
+		}
+	}
+
+	float workX = 0;
+	float workY = 0;
+	float checkX = 0;
+	float checkY = 0;
+	int counter = 0;
+	int period = 0;
+	int limit = 2;
+
+	while (counter < 255 && sqrtf((workX * workX) + (workY * workY)) < 2.0f) {
+		counter++;
+
+		float newX = (workX * workX) - (workY * workY) + coordinateX;
+
+		workY = 2 * workX * workY + coordinateY;
+		workX = newX;
+
+		if (mode & MANDELBROT_PERIODICITY) {
+			if (workX == checkX && workY == checkY) {
+				statistics->periodic++;
+				statistics->iterations += counter;
+				statistics->skipped += 255 - counter;
+
+				return 255;
+			}
+
+			if (++period == limit) {
+				period = 0;
+				limit <<= 1;
+				checkX = workX;
+				checkY = workY;
+			}
+		}
+	}
+
+	statistics->iterations += counter;
+
+	return counter;
+}
+
+inline static int benchmark_mandelbrot_pixel_double(double coordinateX, double coordinateY, uint32_t mode, MandelbrotStatistics* statistics) {
+	if (mode & MANDELBROT_CARDIOID) {
+		double shiftedX = coordinateX - 0.25;
+		double bulbX = coordinateX + 1.0;
+		double q = shiftedX * shiftedX + coordinateY * coordinateY;
+
+		if (q * (q + shiftedX) <= 0.25 * coordinateY * coordinateY) {
+			statistics->cardioid++;
+			statistics->skipped += 255;
+
+			return 255;
+		}
+
+		if (bulbX * bulbX + coordinateY * coordinateY <= 0.0625) {
+			statistics->bulb++;
+			statistics->skipped += 255;
+
+			return 255;
+		}
+	}
+
+	double workX = 0;
+	double workY = 0;
+	double checkX = 0;
+	double checkY = 0;
+	int counter = 0;
+	int period = 0;
+	int limit = 2;
+
+	while (counter < 255 && sqrt((workX * workX) + (workY * workY)) < 2.0) {
+		counter++;
+
+		double newX = (workX * workX) - (workY * workY) + coordinateX;
+
+		workY = 2 * workX * workY + coordinateY;
+		workX = newX;
+
+		if (mode & MANDELBROT_PERIODICITY) {
+			if (workX == checkX && workY == checkY) {
+				statistics->periodic++;
+				statistics->iterations += counter;
+				statistics->skipped += 255 - counter;
+
+				return 255;
+			}
+
+			if (++period == limit) {
+				period = 0;
+				limit <<= 1;
+				checkX = workX;
+				checkY = workY;
+			}
+		}
+	}
+
+	statistics->iterations += counter;
+
+	return counter;
+}
+
+// Returns the sum of the per-pixel iteration counts of the last frame, which is identical for every combination of the fast paths at the same precision
+
+EXPORT uint64_t benchmark_mandelbrot_optimized(uint32_t width, uint32_t height, uint32_t iterations, uint32_t mode, const MandelbrotView* view, MandelbrotStatistics* statistics) {
+	uint64_t checksum = 0;
+
+	memset(statistics, 0, sizeof(MandelbrotStatistics));
+
+	for (uint32_t i = 0; i < iterations; i++) {
+		checksum = 0;
+
+		if (mode & MANDELBROT_DOUBLE) {
+			double
+				deltaX = (view->right - view->left) / width,
+				deltaY = (view->bottom - view->top) / height,
+				coordinateX = view->left;
+
+			for (uint32_t x = 0; x < width; x++) {
+				double coordinateY = view->top;
+
+				for (uint32_t y = 0; y < height; y++) {
+					checksum += benchmark_mandelbrot_pixel_double(coordinateX, coordinateY, mode, statistics);
+					coordinateY += deltaY;
+				}
+
+				coordinateX += deltaX;
+			}
+		} else {
+			float
+				left = (float)view->left,
+				right = (float)view->right,
+				top = (float)view->top,
+				bottom = (float)view->bottom,
+				deltaX = (right - left) / width,
+				deltaY = (bottom - top) / height,
+				coordinateX = left;
+
+			for (uint32_t x = 0; x < width; x++) {
+				float coordinateY = top;
+
+				for (uint32_t y = 0; y < height; y++) {
+					checksum += benchmark_mandelbrot_pixel_float(coordinateX, coordinateY, mode, statistics);
+					coordinateY += deltaY;
+				}
+
+				coordinateX += deltaX;
+			}
+		}
+	}
+
+	return checksum;
+}
+
+// NBody
+
+typedef struct _NBody {
+	double x, y, z, vx, vy, vz, mass;
+} NBody;
+
+inline static void benchmark_nbody_initialize_bodies(NBody* sun, NBody* end) {
+	const double pi = 3.141592653589793;
+	const double solarMass = 4 * pi * pi;
+	const double daysPerYear = 365.24;
+
+	sun[1] = STRUCT_INIT(NBody) { // Jupiter
+		4.84143144246472090e+00,
+		-1.16032004402742839e+00,
+		-1.03622044471123109e-01,
+		1.66007664274403694e-03 * daysPerYear,
+		7.69901118419740425e-03 * daysPerYear,
+		-6.90460016972063023e-05 * daysPerYear,
+		9.54791938424326609e-04 * solarMass
+	};
+
+	sun[2] = STRUCT_INIT(NBody) { // Saturn
+		8.34336671824457987e+00,
+		4.12479856412430479e+00,
+		-4.03523417114321381e-01,
+		-2.76742510726862411e-03 * daysPerYear,
+		4.99852801234917238e-03 * daysPerYear,
+		2.30417297573763929e-05 * daysPerYear,
+		2.85885980666130812e-04 * solarMass
+	};
+
+	sun[3] = STRUCT_INIT(NBody) { // Uranus
+		1.28943695621391310e+01,
+		-1.51111514016986312e+01,
+		-2.23307578892655734e-01,
+		2.96460137564761618e-03 * daysPerYear,
+		2.37847173959480950e-03 * daysPerYear,
+		-2.96589568540237556e-05 * daysPerYear,
+		4.36624404335156298e-05 * solarMass
+	};
+
+	sun[4] = STRUCT_INIT(NBody) { // Neptune
+		1.53796971148509165e+01,
+		-2.59193146099879641e+01,
+		1.79258772950371181e-01,
+		2.68067772490389322e-03 * daysPerYear,
+		1.62824170038242295e-03 * daysPerYear,
+		-9.51592254519715870e-05 * daysPerYear,
+		5.15138902046611451e-05 * solarMass
+	};
+
+	double vx = 0, vy = 0, vz = 0;
+
+	for (NBody* planet = sun + 1; planet <= end; ++planet) {
+		double mass = planet->mass;
+
+		vx += planet->vx * mass;
+		vy += planet->vy * mass;
+		vz += planet->vz * mass;
+	}
+
+	sun->mass = solarMass;
+	sun->vx = vx / -solarMass;
+	sun->vy = vy / -solarMass;
+	sun->vz = vz / -solarMass;
+}
+
+inline static void benchmark_nbody_energy(NBody* sun, NBody* end) {
+	double e = 0.0;
+
+	for (NBody* bi = sun; bi <= end; ++bi) {
+		double
+			imass = bi->mass,
+			ix = bi->x,
+			iy = bi->y,
+			iz = bi->z,
+			ivx = bi->vx,
+			ivy = bi->vy,
+			ivz = bi->vz;
+
+		e += 0.5 * imass * (ivx * ivx + ivy * ivy + ivz * ivz);
+
+		for (NBody* bj = bi + 1; bj <= end; ++bj) {
+			double
+				jmass = bj->mass,
+				dx = ix - bj->x,
+				dy = iy - bj->y,
+				dz = iz - bj->z;
+
+			e -= imass * jmass / sqrt(dx * dx + dy * dy + dz * dz);
+		}
+	}
+}
+
+inline static double benchmark_nbody_get_d2(double dx, double dy, double dz) {
+	double d2 = dx * dx + dy * dy + dz * dz;
+
+	return d2 * sqrt(d2);
+}
+
+inline static void benchmark_nbody_advance(NBody* sun, NBody* end, double distance) {
+	for (NBody* bi = sun; bi < end; ++bi) {
+		double
+			ix = bi->x,
+			iy = bi->y,
+			iz = bi->z,
+			ivx = bi->vx,
+			ivy = bi->vy,
+			ivz = bi->vz,
+			imass = bi->mass;
+
+		for (NBody* bj = bi + 1; bj <= end; ++bj) {
+			double
+				dx = bj->x - ix,
+				dy = bj->y - iy,
+				dz = bj->z - iz,
+				jmass = bj->mass,
+				mag = distance / benchmark_nbody_get_d2(dx, dy, dz);
+
+			bj->vx = bj->vx - dx * imass * mag;
+			bj->vy = bj->vy - dy * imass * mag;
+			bj->vz = bj->vz - dz * imass * mag;
+			ivx = ivx + dx * jmass * mag;
+			ivy = ivy + dy * jmass * mag;
+			ivz = ivz + dz * jmass * mag;
+		}
+
+		bi->vx = ivx;
+		bi->vy = ivy;
+		bi->vz = ivz;
+		bi->x = ix + ivx * distance;
+		bi->y = iy + ivy * distance;
+		bi->z = iz + ivz * distance;
+	}
+
+	end->x = end->x + end->vx * distance;
+	end->y = end->y + end->vy * distance;
+	end->z = end->z + end->vz * distance;
+}
+
+EXPORT double benchmark_nbody(uint32_t advancements) {
+	NBody sun[5] = { 0 };
+	NBody* end = sun + 4;
+
+	benchmark_nbody_initialize_bodies(sun, end);
+	benchmark_nbody_energy(sun, end);
+
+	while (--advancements > 0) {
+		HISTOGRAM_BEGIN();
+
+		benchmark_nbody_advance(sun, end, 0.01);
+
+		HISTOGRAM_END();
+	}
+
+	benchmark_nbody_energy(sun, end);
+
+	return sun[0].x + sun[0].y;
+}
+
+// Sieve of Eratosthenes
+
+inline static uint32_t benchmark_sieve_of_eratosthenes_compute(uint8_t* flags, uint32_t size, uint32_t iterations) {
+	uint32_t a, b, c, prime, count = 0;
+
+	for (a = 1; a <= iterations; a++) {
+		HISTOGRAM_BEGIN();
+
+		count = 0;
+
+		for (b = 0; b < size; b++) {
+			flags[b] = 1; // True
+		}
+
+		for (b = 0; b < size; b++) {
+			if (flags[b] == 1) {
+				prime = b + b + 3;
+				c = b + prime;
+
+				while (c < size) {
+					flags[c] = 0; // False
+					c += prime;
+				}
+
+				count++;
+			}
+		}
+
+		HISTOGRAM_END();
+	}
+
+	return count;
+}
+
+EXPORT uint32_t benchmark_sieve_of_eratosthenes(uint32_t iterations) {
+	const int size = 1024;
+
+	uint8_t flags[size];
+
+	return benchmark_sieve_of_eratosthenes_compute(flags, size, iterations);
+}
+
+EXPORT uint32_t benchmark_sieve_of_eratosthenes_sized(uint32_t iterations, uint32_t size) {
+	uint8_t* flags = (uint8_t*)MALLOC(size, 16);
+	uint32_t count = benchmark_sieve_of_eratosthenes_compute(flags, size, iterations);
+
+	FREE(flags);
+
+	return count;
+}
+
+// Pixar Raytracer
+
+typedef struct _Vector {
+	float x, y, z;
+} Vector;
+
+typedef enum _PixarRayHit {
+	PIXAR_RAYTRACER_NONE = 0,
+	PIXAR_RAYTRACER_LETTER = 1,
+	PIXAR_RAYTRACER_WALL = 2,
+	PIXAR_RAYTRACER_SUN = 3
+} PixarRayHit;
+
+// Random and flocking state is per thread, so copies of a kernel running side by side do not share cache lines
+
+static THREAD_LOCAL uint32_t marsagliaZ, marsagliaW;
+
+inline static Vector benchmark_pixar_raytracer_multiply(Vector left, Vector right) {
+	left.x *= right.x;
+	left.y *= right.y;
+	left.z *= right.z;
+
+	return left;
+}
+
+inline static Vector benchmark_pixar_raytracer_multiply_float(Vector vector, float value) {
+	vector.x *= value;
+	vector.y *= value;
+	vector.z *= value;
+
+	return vector;
+}
+
+inline static float benchmark_pixar_raytracer_modulus(Vector left, Vector right) {
+	return left.x * right.x + left.y * right.y + left.z * right.z;
+}
+
+inline static float benchmark_pixar_raytracer_modulus_self(Vector vector) {
+	return vector.x * vector.x + vector.y * vector.y + vector.z * vector.z;
+}
+
+inline static Vector benchmark_pixar_raytracer_inverse(Vector vector) {
+	return benchmark_pixar_raytracer_multiply_float(vector, 1 / sqrtf(benchmark_pixar_raytracer_modulus_self(vector)));
+}
+
+inline static Vector benchmark_pixar_raytracer_add(Vector left, Vector right) {
+	left.x += right.x;
+	left.y += right.y;
 	left.z += right.z;
 
-	return left;
+	return left;
+}
+
+inline static Vector benchmark_pixar_raytracer_add_float(Vector vector, float value) {
+	vector.x += value;
+	vector.y += value;
+	vector.z += value;
+
+	return vector;
+}
+
+inline static Vector benchmark_pixar_raytracer_cross(Vector to, Vector from) {
+	Vector vector = { 0 };
+
+	vector.x = to.y * from.z - to.z * from.y;
+	vector.y = to.z * from.x - to.x * from.z;
+	vector.z = to.x * from.y - to.y * from.x;
+
+	return vector;
+}
+
+inline static float benchmark_pixar_raytracer_min(float left, float right) {
+	return left < right ? left : right;
+}
+
+inline static float benchmark_pixar_raytracer_box_test(Vector position, Vector lowerLeft, Vector upperRight) {
+	lowerLeft = benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(position, lowerLeft), -1);
+	upperRight = benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(upperRight, position), -1);
+
+	return -benchmark_pixar_raytracer_min(benchmark_pixar_raytracer_min(benchmark_pixar_raytracer_min(lowerLeft.x, upperRight.x), benchmark_pixar_raytracer_min(lowerLeft.y, upperRight.y)), benchmark_pixar_raytracer_min(lowerLeft.z, upperRight.z));
+}
+
+inline static float benchmark_pixar_raytracer_random(void) {
+	marsagliaZ = 36969 * (marsagliaZ & 65535) + (marsagliaZ >> 16);
+	marsagliaW = 18000 * (marsagliaW & 65535) + (marsagliaW >> 16);
+
+	return ((marsagliaZ << 16) + marsagliaW) * 2.0f / 10000000000.0f;
+}
+
+static float benchmark_pixar_raytracer_sample(Vector position, int* hitType) {
+	PHASE_BEGIN(PHASE_PIXAR_RAYTRACER_SAMPLE);
+
+	const int size = 60;
+
+	float distance = 1e9f;
+	Vector f = position;
+	uint8_t letters[size];
+
+	// P              // I              // X              // A              // R
+	letters[0]  = 53; letters[12] = 65; letters[24] = 73; letters[32] = 85; letters[44] = 97; letters[56] = 99;
+	letters[1]  = 79; letters[13] = 79; letters[25] = 79; letters[33] = 79; letters[45] = 79; letters[57] = 87;
+	letters[2]  = 53; letters[14] = 69; letters[26] = 81; letters[34] = 89; letters[46] = 97; letters[58] = 105;
+	letters[3]  = 95; letters[15] = 79; letters[27] = 95; letters[35] = 95; letters[47] = 95; letters[59] = 79;
+	letters[4]  = 53; letters[16] = 67; letters[28] = 73; letters[36] = 89; letters[48] = 97;
+	letters[5]  = 87; letters[17] = 79; letters[29] = 95; letters[37] = 95; letters[49] = 87;
+	letters[6]  = 57; letters[18] = 67; letters[30] = 81; letters[38] = 93; letters[50] = 101;
+	letters[7]  = 87; letters[19] = 95; letters[31] = 79; letters[39] = 79; letters[51] = 87;
+	letters[8]  = 53; letters[20] = 65;                   letters[40] = 87; letters[52] = 97;
+	letters[9]  = 95; letters[21] = 95;                   letters[41] = 87; letters[53] = 95;
+	letters[10] = 57; letters[22] = 69;                   letters[42] = 91; letters[54] = 101;
+	letters[11] = 95; letters[23] = 95;                   letters[43] = 87; letters[55] = 95;
+
+	f.z = 0.0f;
+
+	for (int i = 0; i < size; i += 4) {
+		Vector begin = benchmark_pixar_raytracer_multiply_float(STRUCT_INIT(Vector) { letters[i] - 79.0f, letters[i + 1] - 79.0f, 0.0f }, 0.5f);
+		Vector e = benchmark_pixar_raytracer_add(benchmark_pixar_raytracer_multiply_float(STRUCT_INIT(Vector) { letters[i + 2] - 79.0f, letters[i + 3] - 79.0f, 0.0f }, 0.5f), benchmark_pixar_raytracer_multiply_float(begin, -1.0f));
+		Vector o = benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(f, benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(begin, e), benchmark_pixar_raytracer_min(-benchmark_pixar_raytracer_min(benchmark_pixar_raytracer_modulus(benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(begin, f), -1.0f), e) / benchmark_pixar_raytracer_modulus_self(e), 0.0f), 1.0f))), -1.0f);
+
+		distance = benchmark_pixar_raytracer_min(distance, benchmark_pixar_raytracer_modulus_self(o));
+	}
+
+	distance = sqrtf(distance);
+
+	Vector curves[2] = { 0 };
+
+	curves[0] = STRUCT_INIT(Vector) { -11.0f, 6.0f, 0.0f };
+	curves[1] = STRUCT_INIT(Vector) { 11.0f, 6.0f, 0.0f };
+
+	for (int i = 1; i >= 0; i--) {
+		Vector o = benchmark_pixar_raytracer_add(f, benchmark_pixar_raytracer_multiply_float(curves[i], -1.0f));
+		float m = 0.0f;
+
+		if (o.x > 0.0f) {
+			m = fabsf(sqrtf(benchmark_pixar_raytracer_modulus_self(o)) - 2.0f);
+		} else {
+			if (o.y > 0.0f)
+				o.y += -2.0f;
+			else
+				o.y += 2.0f;
+
+			o.y += sqrtf(benchmark_pixar_raytracer_modulus_self(o));
+		}
+
+		distance = benchmark_pixar_raytracer_min(distance, m);
+	}
+
+	distance = powf(powf(distance, 8.0f) + powf(position.z, 8.0f), 0.125f) - 0.5f;
+	*hitType = PIXAR_RAYTRACER_LETTER;
+
+	float roomDistance = benchmark_pixar_raytracer_min(-benchmark_pixar_raytracer_min(benchmark_pixar_raytracer_box_test(position, STRUCT_INIT(Vector) { -30.0f, -0.5f, -30.0f }, STRUCT_INIT(Vector) { 30.0f, 18.0f, 30.0f }), benchmark_pixar_raytracer_box_test(position, STRUCT_INIT(Vector) { -25.0f, -17.5f, -25.0f }, STRUCT_INIT(Vector) { 25.0f, 20.0f, 25.0f })), benchmark_pixar_raytracer_box_test(STRUCT_INIT(Vector) { fmodf(fabsf(position.x), 8), position.y, position.z }, STRUCT_INIT(Vector) { 1.5f, 18.5f, -25.0f }, STRUCT_INIT(Vector) { 6.5f, 20.0f, 25.0f }));
+
+	if (roomDistance < distance) {
+		distance = roomDistance;
+		*hitType = PIXAR_RAYTRACER_WALL;
+	}
+
+	float sun = 19.9f - position.y;
+
+	if (sun < distance) {
+		distance = sun;
+		*hitType = PIXAR_RAYTRACER_SUN;
+	}
+
+	PHASE_END();
+
+	return distance;
+}
+
+static int benchmark_pixar_raytracer_ray_marching(Vector origin, Vector direction, Vector* hitPosition, Vector* hitNormal) {
+	int hitType = PIXAR_RAYTRACER_NONE;
+	int noHitCount = 0;
+	float distance = 0.0f;
+
+	PHASE_BEGIN(PHASE_PIXAR_RAYTRACER_RAY_MARCHING);
+
+	for (float i = 0; i < 100; i += distance) {
+		*hitPosition = benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(origin, direction), i);
+		distance = benchmark_pixar_raytracer_sample(*hitPosition, &hitType);
+
+		if (distance < 0.01f || ++noHitCount > 99) {
+			*hitNormal = benchmark_pixar_raytracer_inverse(STRUCT_INIT(Vector) { benchmark_pixar_raytracer_sample(benchmark_pixar_raytracer_add(*hitPosition, STRUCT_INIT(Vector) { 0.01f, 0.0f, 0.0f }), &noHitCount) - distance, benchmark_pixar_raytracer_sample(benchmark_pixar_raytracer_add(*hitPosition, STRUCT_INIT(Vector) { 0.0f, 0.01f, 0.0f }), &noHitCount) - distance, benchmark_pixar_raytracer_sample(benchmark_pixar_raytracer_add(*hitPosition, STRUCT_INIT(Vector) { 0.0f, 0.0f, 0.01f }), &noHitCount) - distance });
+
+			PHASE_END();
+
+			return hitType;
+		}
+	}
+
+	PHASE_END();
+
+	return PIXAR_RAYTRACER_NONE;
+}
+
+static Vector benchmark_pixar_raytracer_trace(Vector origin, Vector direction) {
+	Vector
+		sampledPosition = { 1.0f, 1.0f, 1.0f },
+		normal = { 1.0f, 1.0f, 1.0f },
+		color = { 1.0f, 1.0f, 1.0f },
+		attenuation = { 1.0f, 1.0f, 1.0f },
+		lightDirection = benchmark_pixar_raytracer_inverse(STRUCT_INIT(Vector) { 0.6f, 0.6f, 1.0f });
+
+	for (int bounce = 3; bounce > 0; bounce--) {
+		int hitType = benchmark_pixar_raytracer_ray_marching(origin, direction, &sampledPosition, &normal);
+
+		PHASE_BEGIN(PHASE_PIXAR_RAYTRACER_BOUNCE);
+
+		switch (hitType) {
+			case PIXAR_RAYTRACER_NONE:
+				break;
+
+			case PIXAR_RAYTRACER_LETTER: {
+				direction = benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(direction, normal), benchmark_pixar_raytracer_modulus(normal, direction) * -2.0f);
+				origin = benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(sampledPosition, direction), 0.1f);
+				attenuation = benchmark_pixar_raytracer_multiply_float(attenuation, 0.2f);
+
+				break;
+			}
+
+			case PIXAR_RAYTRACER_WALL: {
+				float
+					incidence = benchmark_pixar_raytracer_modulus(normal, lightDirection),
+					p = 6.283185f * benchmark_pixar_raytracer_random(),
+					c = benchmark_pixar_raytracer_random(),
+					s = sqrtf(1.0f - c),
+					g = normal.z < 0 ? -1.0f : 1.0f,
+					u = -1.0f / (g + normal.z),
+					v = normal.x * normal.y * u;
+
+				direction = benchmark_pixar_raytracer_add(benchmark_pixar_raytracer_add(STRUCT_INIT(Vector) { v, g + normal.y * normal.y * u, -normal.y * (cosf(p) * s) }, STRUCT_INIT(Vector) { 1.0f + g * normal.x * normal.x * u, g * v, -g * normal.x }), benchmark_pixar_raytracer_multiply_float(normal, sqrtf(c)));
+				origin = benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(sampledPosition, direction), 0.1f);
+				attenuation = benchmark_pixar_raytracer_multiply_float(attenuation, 0.2f);
+
+				if (incidence > 0 && benchmark_pixar_raytracer_ray_marching(benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(sampledPosition, normal), 0.1f), lightDirection, &sampledPosition, &normal) == PIXAR_RAYTRACER_SUN)
+					color = benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_multiply(benchmark_pixar_raytracer_add(color, attenuation), STRUCT_INIT(Vector) { 500.0f, 400.0f, 100.0f }), incidence);
+
+				break;
+			}
+
+			case PIXAR_RAYTRACER_SUN: {
+				color = benchmark_pixar_raytracer_multiply(benchmark_pixar_raytracer_add(color, attenuation), STRUCT_INIT(Vector) { 50.0f, 80.0f, 100.0f });
+
+				PHASE_END();
+
+				goto escape;
+			}
+		}
+
+		PHASE_END();
+	}
+
+	escape:
+
+	return color;
+}
+
+EXPORT float benchmark_pixar_raytracer(uint32_t width, uint32_t height, uint32_t samples) {
+	marsagliaZ = 666;
+	marsagliaW = 999;
+
+	Vector position = { -22.0f, 5.0f, 25.0f };
+	Vector goal = { -3.0f, 4.0f, 0.0f };
+
+	goal = benchmark_pixar_raytracer_add(benchmark_pixar_raytracer_inverse(goal), benchmark_pixar_raytracer_multiply_float(position, -1.0f));
+
+	Vector left = { goal.z, 0, goal.x };
+
+	left = benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_inverse(left), 1.0f / width);
+
+	Vector up = benchmark_pixar_raytracer_cross(goal, left);
+	Vector color = { 0 };
+	Vector adjust = { 0 };
+
+	for (uint32_t y = height; y > 0; y--) {
+		HISTOGRAM_BEGIN();
+
+		for (uint32_t x = width; x > 0; x--) {
+			for (uint32_t p = samples; p > 0; p--) {
+				color = benchmark_pixar_raytracer_add(color, benchmark_pixar_raytracer_trace(position, benchmark_pixar_raytracer_add(benchmark_pixar_raytracer_inverse(benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(goal, left), x - width / 2 + benchmark_pixar_raytracer_random())), benchmark_pixar_raytracer_multiply_float(up, y - height / 2 + benchmark_pixar_raytracer_random()))));
+			}
+
+			color = benchmark_pixar_raytracer_multiply_float(color, (1.0f / samples) + 14.0f / 241.0f);
+			adjust = benchmark_pixar_raytracer_add_float(color, 1.0f);
+			color = STRUCT_INIT(Vector) {
+				color.x / adjust.x,
+				color.y / adjust.y,
+				color.z / adjust.z
+			};
+
+			color = benchmark_pixar_raytracer_multiply_float(color, 255.0f);
+		}
+
+		HISTOGRAM_END();
+	}
+
+	return color.x + color.y + color.z;
+}
+
+// Pixar Raytracer packets
+
+#if defined(__AVX512F__)
+	#define PIXAR_PACKET 16
+	#define PIXAR_SET(value) _mm512_set1_ps(value)
+	#define PIXAR_LOAD(pointer) _mm512_loadu_ps(pointer)
+	#define PIXAR_STORE(pointer, lanes) _mm512_storeu_ps(pointer, lanes)
+	#define PIXAR_ADD(left, right) _mm512_add_ps(left, right)
+	#define PIXAR_SUBTRACT(left, right) _mm512_sub_ps(left, right)
+	#define PIXAR_MULTIPLY(left, right) _mm512_mul_ps(left, right)
+	#define PIXAR_DIVIDE(left, right) _mm512_div_ps(left, right)
+	// The zero-masked forms with every lane enabled emit the same instructions, the plain ones pass an undefined source that GCC reports as uninitialized in C++
+
+	#define PIXAR_SQRT(lanes) _mm512_maskz_sqrt_ps((__mmask16)0xFFFF, lanes)
+	#define PIXAR_MIN(left, right) _mm512_maskz_min_ps((__mmask16)0xFFFF, left, right)
+	#define PIXAR_MAX(left, right) _mm512_maskz_max_ps((__mmask16)0xFFFF, left, right)
+	#define PIXAR_ABS(lanes) _mm512_abs_ps(lanes)
+	#define PIXAR_FLOOR(lanes) _mm512_maskz_roundscale_ps((__mmask16)0xFFFF, lanes, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)
+	#define PIXAR_LESS(left, right) _mm512_cmp_ps_mask(left, right, _CMP_LT_OQ)
+	#define PIXAR_GREATER(left, right) _mm512_cmp_ps_mask(left, right, _CMP_GT_OQ)
+	#define PIXAR_SELECT(mask, otherwise, then) _mm512_mask_blend_ps(mask, otherwise, then)
+	#define PIXAR_AND(left, right) (PixarMask)((left) & (right))
+	#define PIXAR_AND_NOT(left, right) (PixarMask)((left) & ~(right))
+	#define PIXAR_OR(left, right) (PixarMask)((left) | (right))
+	#define PIXAR_MASK(bits) (PixarMask)(bits)
+	#define PIXAR_BITS(mask) (uint32_t)(mask)
+
+	typedef __m512 PixarLanes;
+	typedef __mmask16 PixarMask;
+#elif defined(__AVX2__)
+	#define PIXAR_PACKET 8
+	#define PIXAR_SET(value) _mm256_set1_ps(value)
+	#define PIXAR_LOAD(pointer) _mm256_loadu_ps(pointer)
+	#define PIXAR_STORE(pointer, lanes) _mm256_storeu_ps(pointer, lanes)
+	#define PIXAR_ADD(left, right) _mm256_add_ps(left, right)
+	#define PIXAR_SUBTRACT(left, right) _mm256_sub_ps(left, right)
+	#define PIXAR_MULTIPLY(left, right) _mm256_mul_ps(left, right)
+	#define PIXAR_DIVIDE(left, right) _mm256_div_ps(left, right)
+	#define PIXAR_SQRT(lanes) _mm256_sqrt_ps(lanes)
+	#define PIXAR_MIN(left, right) _mm256_min_ps(left, right)
+	#define PIXAR_MAX(left, right) _mm256_max_ps(left, right)
+	#define PIXAR_ABS(lanes) _mm256_andnot_ps(_mm256_set1_ps(-0.0f), lanes)
+	#define PIXAR_FLOOR(lanes) _mm256_floor_ps(lanes)
+	#define PIXAR_LESS(left, right) _mm256_cmp_ps(left, right, _CMP_LT_OQ)
+	#define PIXAR_GREATER(left, right) _mm256_cmp_ps(left, right, _CMP_GT_OQ)
+	#define PIXAR_SELECT(mask, otherwise, then) _mm256_blendv_ps(otherwise, then, mask)
+	#define PIXAR_AND(left, right) _mm256_and_ps(left, right)
+	#define PIXAR_AND_NOT(left, right) _mm256_andnot_ps(right, left)
+	#define PIXAR_OR(left, right) _mm256_or_ps(left, right)
+	#define PIXAR_MASK(bits) _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_and_si256(_mm256_set1_epi32((int)(bits)), _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128)), _mm256_setzero_si256()))
+	#define PIXAR_BITS(mask) (uint32_t)_mm256_movemask_ps(mask)
+
+	typedef __m256 PixarLanes;
+	typedef __m256 PixarMask;
+#else
+	#define PIXAR_PACKET 0
+#endif
+
+// Without SIMD the packets keep eight rays and march them one by one
+
+#define PIXAR_PACKET_LANES (PIXAR_PACKET > 0 ? PIXAR_PACKET : 8)
+
+// Rays, packet steps and active lanes over those steps for each of the three bounces and the shadow rays
+
+#define PIXAR_PACKET_STATISTICS 12
+
+typedef struct _PixarPacket {
+	float originX[PIXAR_PACKET_LANES], originY[PIXAR_PACKET_LANES], originZ[PIXAR_PACKET_LANES];
+	float directionX[PIXAR_PACKET_LANES], directionY[PIXAR_PACKET_LANES], directionZ[PIXAR_PACKET_LANES];
+	float positionX[PIXAR_PACKET_LANES], positionY[PIXAR_PACKET_LANES], positionZ[PIXAR_PACKET_LANES];
+	float normalX[PIXAR_PACKET_LANES], normalY[PIXAR_PACKET_LANES], normalZ[PIXAR_PACKET_LANES];
+	float hitType[PIXAR_PACKET_LANES];
+} PixarPacket;
+
+// Packets render the scene of the original card raytracer, benchmark_pixar_raytracer_sample() keeps the arithmetic shared by every implementation of the suite where the room distance is negative everywhere and each ray hits a wall in one step, so there is no divergence to measure
+
+static const uint8_t pixarLetters[60] = {
+	53, 79, 53, 95, 53, 87, 57, 87, 53, 95, 57, 95,
+	65, 79, 69, 79, 67, 79, 67, 95, 65, 95, 69, 95,
+	73, 79, 81, 95, 73, 95, 81, 79,
+	85, 79, 89, 95, 89, 95, 93, 79, 87, 87, 91, 87,
+	97, 79, 97, 95, 97, 87, 101, 87, 97, 95, 101, 95,
+	99, 87, 105, 79
+};
+
+inline static uint32_t benchmark_pixar_raytracer_packet_count(uint32_t lanes) {
+	uint32_t count = 0;
+
+	for (; lanes != 0; lanes &= lanes - 1) {
+		count++;
+	}
+
+	return count;
+}
+
+inline static float benchmark_pixar_raytracer_packet_box_test_scalar(Vector position, Vector lowerLeft, Vector upperRight) {
+	lowerLeft = benchmark_pixar_raytracer_add(position, benchmark_pixar_raytracer_multiply_float(lowerLeft, -1.0f));
+	upperRight = benchmark_pixar_raytracer_add(upperRight, benchmark_pixar_raytracer_multiply_float(position, -1.0f));
+
+	return -benchmark_pixar_raytracer_min(benchmark_pixar_raytracer_min(benchmark_pixar_raytracer_min(lowerLeft.x, upperRight.x), benchmark_pixar_raytracer_min(lowerLeft.y, upperRight.y)), benchmark_pixar_raytracer_min(lowerLeft.z, upperRight.z));
+}
+
+// Same operations in the same order as the packet version below, so both paths differ only in how the lanes are scheduled
+
+static float benchmark_pixar_raytracer_packet_sample_scalar(Vector position, int* hitType) {
+	float distance = 1e9f;
+
+	for (int i = 0; i < 60; i += 4) {
+		float
+			beginX = (pixarLetters[i] - 79.0f) * 0.5f,
+			beginY = (pixarLetters[i + 1] - 79.0f) * 0.5f,
+			eX = (pixarLetters[i + 2] - 79.0f) * 0.5f - beginX,
+			eY = (pixarLetters[i + 3] - 79.0f) * 0.5f - beginY;
+
+		float fX = position.x - beginX, fY = position.y - beginY;
+		float projection = (fX * eX + fY * eY) / (eX * eX + eY * eY);
+		float t = benchmark_pixar_raytracer_min(projection > 0.0f ? projection : 0.0f, 1.0f);
+		float oX = fX - eX * t;
+		float oY = fY - eY * t;
+
+		distance = benchmark_pixar_raytracer_min(distance, oX * oX + oY * oY);
+	}
+
+	distance = sqrtf(distance);
+
+	for (int i = 1; i >= 0; i--) {
+		float oX = position.x - (i == 1 ? 11.0f : -11.0f);
+		float oY = position.y - 6.0f;
+
+		if (oX > 0.0f) {
+			distance = benchmark_pixar_raytracer_min(distance, fabsf(sqrtf(oX * oX + oY * oY) - 2.0f));
+		} else {
+			oY += oY > 0.0f ? -2.0f : 2.0f;
+			distance = benchmark_pixar_raytracer_min(distance, sqrtf(oX * oX + oY * oY));
+		}
+	}
+
+	float distance2 = distance * distance, distance4 = distance2 * distance2;
+	float z2 = position.z * position.z, z4 = z2 * z2;
+
+	distance = sqrtf(sqrtf(sqrtf(distance4 * distance4 + z4 * z4))) - 0.5f;
+	*hitType = PIXAR_RAYTRACER_LETTER;
+
+	float absoluteX = fabsf(position.x);
+	float columnX = absoluteX - floorf(absoluteX * 0.125f) * 8.0f;
+	float roomDistance = benchmark_pixar_raytracer_min(-benchmark_pixar_raytracer_min(benchmark_pixar_raytracer_packet_box_test_scalar(position, STRUCT_INIT(Vector) { -30.0f, -0.5f, -30.0f }, STRUCT_INIT(Vector) { 30.0f, 18.0f, 30.0f }), benchmark_pixar_raytracer_packet_box_test_scalar(position, STRUCT_INIT(Vector) { -25.0f, 17.0f, -25.0f }, STRUCT_INIT(Vector) { 25.0f, 20.0f, 25.0f })), benchmark_pixar_raytracer_packet_box_test_scalar(STRUCT_INIT(Vector) { columnX, position.y, position.z }, STRUCT_INIT(Vector) { 1.5f, 18.5f, -25.0f }, STRUCT_INIT(Vector) { 6.5f, 20.0f, 25.0f }));
+
+	if (roomDistance < distance) {
+		distance = roomDistance;
+		*hitType = PIXAR_RAYTRACER_WALL;
+	}
+
+	float sun = 19.9f - position.y;
+
+	if (sun < distance) {
+		distance = sun;
+		*hitType = PIXAR_RAYTRACER_SUN;
+	}
+
+	return distance;
+}
+
+static int benchmark_pixar_raytracer_packet_marching_scalar(Vector origin, Vector direction, Vector* hitPosition, Vector* hitNormal) {
+	int hitType = PIXAR_RAYTRACER_NONE;
+	int noHitCount = 0;
+	float distance = 0.0f;
+
+	for (float i = 0; i < 100; i += distance) {
+		*hitPosition = benchmark_pixar_raytracer_add(origin, benchmark_pixar_raytracer_multiply_float(direction, i));
+		distance = benchmark_pixar_raytracer_packet_sample_scalar(*hitPosition, &hitType);
+
+		if (distance < 0.01f || ++noHitCount > 99) {
+			*hitNormal = benchmark_pixar_raytracer_inverse(STRUCT_INIT(Vector) { benchmark_pixar_raytracer_packet_sample_scalar(benchmark_pixar_raytracer_add(*hitPosition, STRUCT_INIT(Vector) { 0.01f, 0.0f, 0.0f }), &noHitCount) - distance, benchmark_pixar_raytracer_packet_sample_scalar(benchmark_pixar_raytracer_add(*hitPosition, STRUCT_INIT(Vector) { 0.0f, 0.01f, 0.0f }), &noHitCount) - distance, benchmark_pixar_raytracer_packet_sample_scalar(benchmark_pixar_raytracer_add(*hitPosition, STRUCT_INIT(Vector) { 0.0f, 0.0f, 0.01f }), &noHitCount) - distance });
+
+			return hitType;
+		}
+	}
+
+	return PIXAR_RAYTRACER_NONE;
+}
+
+#if PIXAR_PACKET > 0
+	inline static PixarLanes benchmark_pixar_raytracer_packet_box_test(PixarLanes x, PixarLanes y, PixarLanes z, Vector lowerLeft, Vector upperRight) {
+		PixarLanes minimumX = PIXAR_MIN(PIXAR_SUBTRACT(x, PIXAR_SET(lowerLeft.x)), PIXAR_SUBTRACT(PIXAR_SET(upperRight.x), x));
+		PixarLanes minimumY = PIXAR_MIN(PIXAR_SUBTRACT(y, PIXAR_SET(lowerLeft.y)), PIXAR_SUBTRACT(PIXAR_SET(upperRight.y), y));
+		PixarLanes minimumZ = PIXAR_MIN(PIXAR_SUBTRACT(z, PIXAR_SET(lowerLeft.z)), PIXAR_SUBTRACT(PIXAR_SET(upperRight.z), z));
+
+		return PIXAR_SUBTRACT(PIXAR_SET(0.0f), PIXAR_MIN(PIXAR_MIN(minimumX, minimumY), minimumZ));
+	}
+
+	// The scalar distance field in structure-of-arrays form, branches become selects
+
+	static PixarLanes benchmark_pixar_raytracer_packet_sample(PixarLanes x, PixarLanes y, PixarLanes z, PixarLanes* hitType) {
+		PixarLanes distance = PIXAR_SET(1e9f);
+
+		for (int i = 0; i < 60; i += 4) {
+			float
+				beginX = (pixarLetters[i] - 79.0f) * 0.5f,
+				beginY = (pixarLetters[i + 1] - 79.0f) * 0.5f,
+				eX = (pixarLetters[i + 2] - 79.0f) * 0.5f - beginX,
+				eY = (pixarLetters[i + 3] - 79.0f) * 0.5f - beginY;
+
+			PixarLanes fX = PIXAR_SUBTRACT(x, PIXAR_SET(beginX)), fY = PIXAR_SUBTRACT(y, PIXAR_SET(beginY));
+			PixarLanes t = PIXAR_MIN(PIXAR_MAX(PIXAR_DIVIDE(PIXAR_ADD(PIXAR_MULTIPLY(fX, PIXAR_SET(eX)), PIXAR_MULTIPLY(fY, PIXAR_SET(eY))), PIXAR_SET(eX * eX + eY * eY)), PIXAR_SET(0.0f)), PIXAR_SET(1.0f));
+			PixarLanes oX = PIXAR_SUBTRACT(fX, PIXAR_MULTIPLY(PIXAR_SET(eX), t));
+			PixarLanes oY = PIXAR_SUBTRACT(fY, PIXAR_MULTIPLY(PIXAR_SET(eY), t));
+
+			distance = PIXAR_MIN(distance, PIXAR_ADD(PIXAR_MULTIPLY(oX, oX), PIXAR_MULTIPLY(oY, oY)));
+		}
+
+		distance = PIXAR_SQRT(distance);
+
+		for (int i = 1; i >= 0; i--) {
+			PixarLanes oX = PIXAR_SUBTRACT(x, PIXAR_SET(i == 1 ? 11.0f : -11.0f));
+			PixarLanes oY = PIXAR_SUBTRACT(y, PIXAR_SET(6.0f));
+			PixarLanes arc = PIXAR_ABS(PIXAR_SUBTRACT(PIXAR_SQRT(PIXAR_ADD(PIXAR_MULTIPLY(oX, oX), PIXAR_MULTIPLY(oY, oY))), PIXAR_SET(2.0f)));
+
+			oY = PIXAR_ADD(oY, PIXAR_SELECT(PIXAR_GREATER(oY, PIXAR_SET(0.0f)), PIXAR_SET(2.0f), PIXAR_SET(-2.0f)));
+
+			PixarLanes end = PIXAR_SQRT(PIXAR_ADD(PIXAR_MULTIPLY(oX, oX), PIXAR_MULTIPLY(oY, oY)));
+
+			distance = PIXAR_MIN(distance, PIXAR_SELECT(PIXAR_GREATER(oX, PIXAR_SET(0.0f)), end, arc));
+		}
+
+		PixarLanes distance2 = PIXAR_MULTIPLY(distance, distance), distance4 = PIXAR_MULTIPLY(distance2, distance2);
+		PixarLanes z2 = PIXAR_MULTIPLY(z, z), z4 = PIXAR_MULTIPLY(z2, z2);
+
+		distance = PIXAR_SUBTRACT(PIXAR_SQRT(PIXAR_SQRT(PIXAR_SQRT(PIXAR_ADD(PIXAR_MULTIPLY(distance4, distance4), PIXAR_MULTIPLY(z4, z4))))), PIXAR_SET(0.5f));
+		*hitType = PIXAR_SET((float)PIXAR_RAYTRACER_LETTER);
+
+		PixarLanes absoluteX = PIXAR_ABS(x);
+		PixarLanes columnX = PIXAR_SUBTRACT(absoluteX, PIXAR_MULTIPLY(PIXAR_FLOOR(PIXAR_MULTIPLY(absoluteX, PIXAR_SET(0.125f))), PIXAR_SET(8.0f)));
+		PixarLanes roomDistance = PIXAR_MIN(PIXAR_SUBTRACT(PIXAR_SET(0.0f), PIXAR_MIN(benchmark_pixar_raytracer_packet_box_test(x, y, z, STRUCT_INIT(Vector) { -30.0f, -0.5f, -30.0f }, STRUCT_INIT(Vector) { 30.0f, 18.0f, 30.0f }), benchmark_pixar_raytracer_packet_box_test(x, y, z, STRUCT_INIT(Vector) { -25.0f, 17.0f, -25.0f }, STRUCT_INIT(Vector) { 25.0f, 20.0f, 25.0f }))), benchmark_pixar_raytracer_packet_box_test(columnX, y, z, STRUCT_INIT(Vector) { 1.5f, 18.5f, -25.0f }, STRUCT_INIT(Vector) { 6.5f, 20.0f, 25.0f }));
+		PixarMask wall = PIXAR_LESS(roomDistance, distance);
+
+		distance = PIXAR_SELECT(wall, distance, roomDistance);
+		*hitType = PIXAR_SELECT(wall, *hitType, PIXAR_SET((float)PIXAR_RAYTRACER_WALL));
+
+		PixarLanes sun = PIXAR_SUBTRACT(PIXAR_SET(19.9f), y);
+		PixarMask sky = PIXAR_LESS(sun, distance);
+
+		distance = PIXAR_SELECT(sky, distance, sun);
+		*hitType = PIXAR_SELECT(sky, *hitType, PIXAR_SET((float)PIXAR_RAYTRACER_SUN));
+
+		return distance;
+	}
+
+	// Lanes retire under a mask once they hit or run out of steps, the normals of all hits are estimated together after the loop
+
+	static void benchmark_pixar_raytracer_packet_marching_vector(PixarPacket* packet, uint32_t lanes, uint64_t* statistics) {
+		PixarLanes originX = PIXAR_LOAD(packet->originX), originY = PIXAR_LOAD(packet->originY), originZ = PIXAR_LOAD(packet->originZ);
+		PixarLanes directionX = PIXAR_LOAD(packet->directionX), directionY = PIXAR_LOAD(packet->directionY), directionZ = PIXAR_LOAD(packet->directionZ);
+		PixarLanes t = PIXAR_SET(0.0f), hitType = PIXAR_SET((float)PIXAR_RAYTRACER_NONE), hitDistance = PIXAR_SET(0.0f);
+		PixarLanes positionX = PIXAR_SET(0.0f), positionY = PIXAR_SET(0.0f), positionZ = PIXAR_SET(0.0f);
+		PixarMask active = PIXAR_MASK(lanes);
+		uint32_t hits = 0;
+
+		for (int step = 1; PIXAR_BITS(active) != 0; step++) {
+			statistics[1]++;
+			statistics[2] += benchmark_pixar_raytracer_packet_count(PIXAR_BITS(active));
+
+			PixarLanes x = PIXAR_ADD(originX, PIXAR_MULTIPLY(directionX, t));
+			PixarLanes y = PIXAR_ADD(originY, PIXAR_MULTIPLY(directionY, t));
+			PixarLanes z = PIXAR_ADD(originZ, PIXAR_MULTIPLY(directionZ, t));
+			PixarLanes type;
+			PixarLanes distance = benchmark_pixar_raytracer_packet_sample(x, y, z, &type);
+			PixarMask done = step > 99 ? active : PIXAR_AND(active, PIXAR_LESS(distance, PIXAR_SET(0.01f)));
+
+			positionX = PIXAR_SELECT(done, positionX, x);
+			positionY = PIXAR_SELECT(done, positionY, y);
+			positionZ = PIXAR_SELECT(done, positionZ, z);
+			hitDistance = PIXAR_SELECT(done, hitDistance, distance);
+			hitType = PIXAR_SELECT(done, hitType, type);
+			hits |= PIXAR_BITS(done);
+			active = PIXAR_AND_NOT(active, done);
+			t = PIXAR_ADD(t, distance);
+			active = PIXAR_AND(active, PIXAR_LESS(t, PIXAR_SET(100.0f)));
+		}
+
+		PIXAR_STORE(packet->positionX, positionX);
+		PIXAR_STORE(packet->positionY, positionY);
+		PIXAR_STORE(packet->positionZ, positionZ);
+		PIXAR_STORE(packet->hitType, hitType);
+
+		if (hits != 0) {
+			PixarLanes ignored;
+			PixarLanes normalX = PIXAR_SUBTRACT(benchmark_pixar_raytracer_packet_sample(PIXAR_ADD(positionX, PIXAR_SET(0.01f)), positionY, positionZ, &ignored), hitDistance);
+			PixarLanes normalY = PIXAR_SUBTRACT(benchmark_pixar_raytracer_packet_sample(positionX, PIXAR_ADD(positionY, PIXAR_SET(0.01f)), positionZ, &ignored), hitDistance);
+			PixarLanes normalZ = PIXAR_SUBTRACT(benchmark_pixar_raytracer_packet_sample(positionX, positionY, PIXAR_ADD(positionZ, PIXAR_SET(0.01f)), &ignored), hitDistance);
+			PixarLanes length = PIXAR_DIVIDE(PIXAR_SET(1.0f), PIXAR_SQRT(PIXAR_ADD(PIXAR_ADD(PIXAR_MULTIPLY(normalX, normalX), PIXAR_MULTIPLY(normalY, normalY)), PIXAR_MULTIPLY(normalZ, normalZ))));
+
+			PIXAR_STORE(packet->normalX, PIXAR_MULTIPLY(normalX, length));
+			PIXAR_STORE(packet->normalY, PIXAR_MULTIPLY(normalY, length));
+			PIXAR_STORE(packet->normalZ, PIXAR_MULTIPLY(normalZ, length));
+		}
+	}
+#endif
+
+static void benchmark_pixar_raytracer_packet_marching(PixarPacket* packet, uint32_t lanes, int vectorized, uint64_t* statistics) {
+	statistics[0] += benchmark_pixar_raytracer_packet_count(lanes);
+
+	#if PIXAR_PACKET > 0
+		if (vectorized) {
+			benchmark_pixar_raytracer_packet_marching_vector(packet, lanes, statistics);
+
+			return;
+		}
+	#else
+		(void)vectorized;
+	#endif
+
+	for (uint32_t i = 0; i < PIXAR_PACKET_LANES; i++) {
+		if ((lanes & (1u << i)) == 0)
+			continue;
+
+		Vector position = { 0.0f, 0.0f, 0.0f }, normal = { 0.0f, 0.0f, 0.0f };
+
+		packet->hitType[i] = (float)benchmark_pixar_raytracer_packet_marching_scalar(STRUCT_INIT(Vector) { packet->originX[i], packet->originY[i], packet->originZ[i] }, STRUCT_INIT(Vector) { packet->directionX[i], packet->directionY[i], packet->directionZ[i] }, &position, &normal);
+		packet->positionX[i] = position.x;
+		packet->positionY[i] = position.y;
+		packet->positionZ[i] = position.z;
+		packet->normalX[i] = normal.x;
+		packet->normalY[i] = normal.y;
+		packet->normalZ[i] = normal.z;
+	}
+}
+
+// Shading runs lane by lane in packet order, so both marching paths consume the same random numbers as long as their hits agree
+
+static void benchmark_pixar_raytracer_packet_trace(PixarPacket* packet, uint32_t lanes, int vectorized, Vector* colors, uint8_t* firstHits, uint64_t* statistics) {
+	PixarPacket shadow;
+	Vector attenuation[PIXAR_PACKET_LANES];
+	float incidences[PIXAR_PACKET_LANES];
+	Vector lightDirection = benchmark_pixar_raytracer_inverse(STRUCT_INIT(Vector) { 0.6f, 0.6f, 1.0f });
+
+	for (uint32_t i = 0; i < PIXAR_PACKET_LANES; i++) {
+		colors[i] = STRUCT_INIT(Vector) { 0.0f, 0.0f, 0.0f };
+		attenuation[i] = STRUCT_INIT(Vector) { 1.0f, 1.0f, 1.0f };
+		shadow.originX[i] = 0.0f;
+		shadow.originY[i] = 0.0f;
+		shadow.originZ[i] = 0.0f;
+		shadow.directionX[i] = lightDirection.x;
+		shadow.directionY[i] = lightDirection.y;
+		shadow.directionZ[i] = lightDirection.z;
+	}
+
+	for (int bounce = 0; bounce < 3 && lanes != 0; bounce++) {
+		uint32_t shadowed = 0;
+
+		benchmark_pixar_raytracer_packet_marching(packet, lanes, vectorized, statistics + bounce * 3);
+
+		for (uint32_t i = 0; i < PIXAR_PACKET_LANES; i++) {
+			if ((lanes & (1u << i)) == 0)
+				continue;
+
+			int hitType = (int)packet->hitType[i];
+
+			Vector
+				sampledPosition = { packet->positionX[i], packet->positionY[i], packet->positionZ[i] },
+				normal = { packet->normalX[i], packet->normalY[i], packet->normalZ[i] },
+				direction = { packet->directionX[i], packet->directionY[i], packet->directionZ[i] },
+				origin = { packet->originX[i], packet->originY[i], packet->originZ[i] };
+
+			if (bounce == 0 && firstHits != NULL)
+				firstHits[i] = (uint8_t)hitType;
+
+			switch (hitType) {
+				case PIXAR_RAYTRACER_NONE: {
+					lanes &= ~(1u << i);
+
+					break;
+				}
+
+				case PIXAR_RAYTRACER_LETTER: {
+					direction = benchmark_pixar_raytracer_add(direction, benchmark_pixar_raytracer_multiply_float(normal, benchmark_pixar_raytracer_modulus(normal, direction) * -2.0f));
+					origin = benchmark_pixar_raytracer_add(sampledPosition, benchmark_pixar_raytracer_multiply_float(direction, 0.1f));
+					attenuation[i] = benchmark_pixar_raytracer_multiply_float(attenuation[i], 0.2f);
+
+					break;
+				}
+
+				case PIXAR_RAYTRACER_WALL: {
+					float
+						incidence = benchmark_pixar_raytracer_modulus(normal, lightDirection),
+						p = 6.283185f * benchmark_pixar_raytracer_random(),
+						c = benchmark_pixar_raytracer_random(),
+						s = sqrtf(1.0f - c),
+						g = normal.z < 0 ? -1.0f : 1.0f,
+						u = -1.0f / (g + normal.z),
+						v = normal.x * normal.y * u;
+
+					direction = benchmark_pixar_raytracer_add(benchmark_pixar_raytracer_add(benchmark_pixar_raytracer_multiply_float(STRUCT_INIT(Vector) { v, g + normal.y * normal.y * u, -normal.y }, cosf(p) * s), benchmark_pixar_raytracer_multiply_float(STRUCT_INIT(Vector) { 1.0f + g * normal.x * normal.x * u, g * v, -g * normal.x }, sinf(p) * s)), benchmark_pixar_raytracer_multiply_float(normal, sqrtf(c)));
+					origin = benchmark_pixar_raytracer_add(sampledPosition, benchmark_pixar_raytracer_multiply_float(direction, 0.1f));
+					attenuation[i] = benchmark_pixar_raytracer_multiply_float(attenuation[i], 0.2f);
+
+					if (incidence > 0) {
+						Vector shadowOrigin = benchmark_pixar_raytracer_add(sampledPosition, benchmark_pixar_raytracer_multiply_float(normal, 0.1f));
+
+						shadow.originX[i] = shadowOrigin.x;
+						shadow.originY[i] = shadowOrigin.y;
+						shadow.originZ[i] = shadowOrigin.z;
+						incidences[i] = incidence;
+						shadowed |= 1u << i;
+					}
+
+					break;
+				}
+
+				case PIXAR_RAYTRACER_SUN: {
+					colors[i] = benchmark_pixar_raytracer_add(colors[i], benchmark_pixar_raytracer_multiply(attenuation[i], STRUCT_INIT(Vector) { 50.0f, 80.0f, 100.0f }));
+					lanes &= ~(1u << i);
+
+					break;
+				}
+			}
+
+			packet->originX[i] = origin.x;
+			packet->originY[i] = origin.y;
+			packet->originZ[i] = origin.z;
+			packet->directionX[i] = direction.x;
+			packet->directionY[i] = direction.y;
+			packet->directionZ[i] = direction.z;
+		}
+
+		if (shadowed != 0) {
+			benchmark_pixar_raytracer_packet_marching(&shadow, shadowed, vectorized, statistics + 9);
+
+			for (uint32_t i = 0; i < PIXAR_PACKET_LANES; i++) {
+				if ((shadowed & (1u << i)) != 0 && (int)shadow.hitType[i] == PIXAR_RAYTRACER_SUN)
+					colors[i] = benchmark_pixar_raytracer_add(colors[i], benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_multiply(attenuation[i], STRUCT_INIT(Vector) { 500.0f, 400.0f, 100.0f }), incidences[i]));
+			}
+		}
+	}
+}
+
+// Packet width, 16 for AVX-512, 8 for AVX2 and 0 when packets are marched one ray at a time
+
+EXPORT uint32_t benchmark_pixar_raytracer_packet_width(void) {
+	return PIXAR_PACKET;
+}
+
+// Returns the mean radiance per camera ray, firstHits receives the first hit of every ray and statistics the PIXAR_PACKET_STATISTICS counters, both may be null
+
+EXPORT float benchmark_pixar_raytracer_packet(uint32_t width, uint32_t height, uint32_t samples, int vectorized, uint8_t* firstHits, uint64_t* statistics) {
+	marsagliaZ = 666;
+	marsagliaW = 999;
+
+	uint64_t counters[PIXAR_PACKET_STATISTICS] = { 0 };
+	Vector position = { -22.0f, 5.0f, 25.0f };
+	Vector goal = benchmark_pixar_raytracer_inverse(benchmark_pixar_raytracer_add(STRUCT_INIT(Vector) { -3.0f, 4.0f, 0.0f }, benchmark_pixar_raytracer_multiply_float(position, -1.0f)));
+	Vector left = benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_inverse(STRUCT_INIT(Vector) { goal.z, 0.0f, -goal.x }), 1.0f / width);
+	Vector up = benchmark_pixar_raytracer_cross(goal, left);
+	Vector colors[PIXAR_PACKET_LANES];
+	PixarPacket packet;
+	uint32_t rays = width * height * samples;
+	double radiance = 0.0;
+
+	for (uint32_t first = 0; first < rays; first += PIXAR_PACKET_LANES) {
+		uint32_t count = rays - first < PIXAR_PACKET_LANES ? rays - first : PIXAR_PACKET_LANES;
+
+		HISTOGRAM_BEGIN();
+
+		for (uint32_t i = 0; i < count; i++) {
+			uint32_t pixel = (first + i) / samples;
+			int x = (int)(width - 1 - pixel % width);
+			int y = (int)(height - 1 - pixel / width);
+			float offsetX = (float)(x - (int)width / 2) + benchmark_pixar_raytracer_random();
+			float offsetY = (float)(y - (int)height / 2) + benchmark_pixar_raytracer_random();
+			Vector direction = benchmark_pixar_raytracer_inverse(benchmark_pixar_raytracer_add(benchmark_pixar_raytracer_add(goal, benchmark_pixar_raytracer_multiply_float(left, offsetX)), benchmark_pixar_raytracer_multiply_float(up, offsetY)));
+
+			packet.originX[i] = position.x;
+			packet.originY[i] = position.y;
+			packet.originZ[i] = position.z;
+			packet.directionX[i] = direction.x;
+			packet.directionY[i] = direction.y;
+			packet.directionZ[i] = direction.z;
+		}
+
+		for (uint32_t i = count; i < PIXAR_PACKET_LANES; i++) {
+			packet.originX[i] = packet.originY[i] = packet.originZ[i] = 0.0f;
+			packet.directionX[i] = packet.directionY[i] = packet.directionZ[i] = 0.0f;
+		}
+
+		benchmark_pixar_raytracer_packet_trace(&packet, (uint32_t)((1ull << count) - 1), vectorized, colors, firstHits != NULL ? firstHits + first : NULL, counters);
+
+		for (uint32_t i = 0; i < count; i++) {
+			radiance += colors[i].x + colors[i].y + colors[i].z;
+		}
+
+		HISTOGRAM_END();
+	}
+
+	if (statistics != NULL)
+		memcpy(statistics, counters, sizeof(counters));
+
+	return (float)(radiance / rays);
+}
+
+// Fireflies Flocking
+
+typedef struct _Boid {
+	Vector position, velocity, acceleration;
+} Boid;
+
+static THREAD_LOCAL uint32_t parkMiller;
+static THREAD_LOCAL float maxSpeed;
+static THREAD_LOCAL float maxForce;
+static THREAD_LOCAL float separationDistance;
+static THREAD_LOCAL float neighbourDistance;
+
+inline static void benchmark_fireflies_flocking_add(Vector* left, const Vector* right) {
+	left->x += right->x;
+	left->y += right->y;
+	left->z += right->z;
+}
+
+inline static void benchmark_fireflies_flocking_subtract(Vector* left, const Vector* right) {
+	left->x -= right->x;
+	left->y -= right->y;
+	left->z -= right->z;
+}
+
+inline static void benchmark_fireflies_flocking_divide(Vector* vector, float value) {
+	vector->x /= value;
+	vector->y /= value;
+	vector->z /= value;
+}
+
+inline static void benchmark_fireflies_flocking_multiply(Vector* vector, float value) {
+	vector->x *= value;
+	vector->y *= value;
+	vector->z *= value;
+}
+
+inline static void benchmark_fireflies_flocking_normalize(Vector* vector) {
+	float length = sqrtf(vector->x * vector->x + vector->y * vector->y + vector->z * vector->z);
+
+	vector->x /= length;
+	vector->y /= length;
+	vector->z /= length;
+}
+
+inline static float benchmark_fireflies_flocking_length(Vector* vector) {
+	return sqrtf(vector->x * vector->x + vector->y * vector->y + vector->z * vector->z);
+}
+
+inline static float benchmark_fireflies_flocking_random(void) {
+	parkMiller = (uint32_t)(((uint64_t)parkMiller * 48271u) % 0x7fffffff);
+
+	return parkMiller / 10000000.0f;
+}
+
+EXPORT float benchmark_fireflies_flocking(uint32_t boids, uint32_t lifetime) {
+	parkMiller = 666;
+	maxSpeed = 1.0f;
+	maxForce = 0.03f;
+	separationDistance = 15.0f;
+	neighbourDistance = 30.0f;
+
+	Boid* fireflies = (Boid*)MALLOC(boids * sizeof(Boid), 16);
+
+	for (uint32_t i = 0; i < boids; ++i) {
+		fireflies[i].position = STRUCT_INIT(Vector) { benchmark_fireflies_flocking_random(), benchmark_fireflies_flocking_random(), benchmark_fireflies_flocking_random() };
+		fireflies[i].velocity = STRUCT_INIT(Vector) { benchmark_fireflies_flocking_random(), benchmark_fireflies_flocking_random(), benchmark_fireflies_flocking_random() };
+		fireflies[i].acceleration = STRUCT_INIT(Vector) { 0.0f, 0.0f, 0.0f };
+	}
+
+	for (uint32_t i = 0; i < lifetime; ++i) {
+		HISTOGRAM_BEGIN();
+
+		// Update
+		PHASE_BEGIN(PHASE_FIREFLIES_FLOCKING_UPDATE);
+
+		for (uint32_t boid = 0; boid < boids; ++boid) {
+			benchmark_fireflies_flocking_add(&fireflies[boid].velocity, &fireflies[boid].acceleration);
+
+			float speed = benchmark_fireflies_flocking_length(&fireflies[boid].velocity);
+
+			if (speed > maxSpeed) {
+				benchmark_fireflies_flocking_divide(&fireflies[boid].velocity, speed);
+				benchmark_fireflies_flocking_multiply(&fireflies[boid].velocity, maxSpeed);
+			}
+
+			benchmark_fireflies_flocking_add(&fireflies[boid].position, &fireflies[boid].velocity);
+			benchmark_fireflies_flocking_multiply(&fireflies[boid].acceleration, maxSpeed);
+		}
+
+		PHASE_END();
+
+		// Separation
+		PHASE_BEGIN(PHASE_FIREFLIES_FLOCKING_SEPARATION);
+
+		for (uint32_t boid = 0; boid < boids; ++boid) {
+			Vector separation = { 0 };
+			int count = 0;
+
+			for (uint32_t target = 0; target < boids; ++target) {
+				Vector position = fireflies[boid].position;
+
+				benchmark_fireflies_flocking_subtract(&position, &fireflies[target].position);
+
+				float distance = benchmark_fireflies_flocking_length(&position);
+
+				if (distance > 0.0f && distance < separationDistance) {
+					benchmark_fireflies_flocking_normalize(&position);
+					benchmark_fireflies_flocking_divide(&position, distance);
+
+					separation = position;
+					count++;
+				}
+			}
+
+			if (count > 0) {
+				benchmark_fireflies_flocking_divide(&separation, (float)count);
+				benchmark_fireflies_flocking_normalize(&separation);
+				benchmark_fireflies_flocking_multiply(&separation, maxSpeed);
+				benchmark_fireflies_flocking_subtract(&separation, &fireflies[boid].velocity);
+
+				float force = benchmark_fireflies_flocking_length(&separation);
+
+				if (force > maxForce) {
+					benchmark_fireflies_flocking_divide(&separation, force);
+					benchmark_fireflies_flocking_multiply(&separation, maxForce);
+				}
+
+				benchmark_fireflies_flocking_multiply(&separation, 1.5f);
+				benchmark_fireflies_flocking_add(&fireflies[boid].acceleration, &separation);
+			}
+		}
+
+		PHASE_END();
+
+		// Cohesion
+		PHASE_BEGIN(PHASE_FIREFLIES_FLOCKING_COHESION);
+
+		for (uint32_t boid = 0; boid < boids; ++boid) {
+			Vector cohesion = { 0 };
+			int count = 0;
+
+			for (uint32_t target = 0; target < boids; ++target) {
+				Vector position = fireflies[boid].position;
+
+				benchmark_fireflies_flocking_subtract(&position, &fireflies[target].position);
+
+				float distance = benchmark_fireflies_flocking_length(&position);
+
+				if (distance > 0.0f && distance < neighbourDistance) {
+					cohesion = fireflies[boid].position;
+					count++;
+				}
+			}
+
+			if (count > 0) {
+				benchmark_fireflies_flocking_divide(&cohesion, (float)count);
+				benchmark_fireflies_flocking_subtract(&cohesion, &fireflies[boid].position);
+				benchmark_fireflies_flocking_normalize(&cohesion);
+				benchmark_fireflies_flocking_multiply(&cohesion, maxSpeed);
+				benchmark_fireflies_flocking_subtract(&cohesion, &fireflies[boid].velocity);
+
+				float force = benchmark_fireflies_flocking_length(&cohesion);
+
+				if (force > maxForce) {
+					benchmark_fireflies_flocking_divide(&cohesion, force);
+					benchmark_fireflies_flocking_multiply(&cohesion, maxForce);
+				}
+
+				benchmark_fireflies_flocking_add(&fireflies[boid].acceleration, &cohesion);
+			}
+		}
+
+		PHASE_END();
+
+		HISTOGRAM_END();
+	}
+
+	FREE(fireflies);
+
+	return (float)parkMiller;
+}
+
+// Polynomials
+
+EXPORT float benchmark_polynomials(uint32_t iterations) {
+	const float x = 0.2f;
+
+	float pu = 0.0f;
+	float poly[100] = { 0 };
+
+	for (uint32_t i = 0; i < iterations; i++) {
+		HISTOGRAM_BEGIN();
+
+		float mu = 10.0f;
+		float s;
+		int j;
+
+		for (j = 0; j < 100; j++) {
+			poly[j] = mu = (mu + 2.0f) / 2.0f;
+		}
+
+		s = 0.0f;
+
+		for (j = 0; j < 100; j++) {
+			s = x * s + poly[j];
+		}
+
+		pu += s;
+
+		HISTOGRAM_END();
+	}
+
+	return pu;
+}
+
+// Particle Kinematics
+
+typedef struct _Particle {
+	float x, y, z, vx, vy, vz;
+} Particle;
+
+EXPORT float benchmark_particle_kinematics(uint32_t quantity, uint32_t iterations) {
+	Particle* particles = (Particle*)MALLOC(quantity * sizeof(Particle), 16);
+
+	for (uint32_t i = 0; i < quantity; ++i) {
+		particles[i].x = (float)i;
+		particles[i].y = (float)(i + 1);
+		particles[i].z = (float)(i + 2);
+		particles[i].vx = 1.0f;
+		particles[i].vy = 2.0f;
+		particles[i].vz = 3.0f;
+	}
+
+	for (uint32_t a = 0; a < iterations; ++a) {
+		HISTOGRAM_BEGIN();
+
+		for (uint32_t b = 0, c = quantity; b < c; ++b) {
+			Particle* p = &particles[b];
+
+			p->x += p->vx;
+			p->y += p->vy;
+			p->z += p->vz;
+		}
+
+		HISTOGRAM_END();
+	}
+
+	Particle particle = { particles[0].x, particles[0].y, particles[0].z };
+
+	FREE(particles);
+
+	return particle.x + particle.y + particle.z;
+}
+
+// Arcfour
+
+inline static int benchmark_arcfour_key_setup(uint8_t* state, uint8_t* key, int length) {
+	int i, j;
+	uint8_t t;
+
+	for (i = 0; i < 256; ++i) {
+		state[i] = (uint8_t)i;
+	}
+
+	for (i = 0, j = 0; i < 256; ++i) {
+		j = (j + state[i] + key[i % length]) % 256;
+		t = state[i];
+		state[i] = state[j];
+		state[j] = t;
+	}
+
+	return i;
+}
+
+inline static int benchmark_arcfour_generate_stream(uint8_t* state, uint8_t* buffer, int length) {
+	int i, j;
+	int idx;
+	uint8_t t;
+
+	for (idx = 0, i = 0, j = 0; idx < length; ++idx) {
+		i = (i + 1) % 256;
+		j = (j + state[i]) % 256;
+		t = state[i];
+		state[i] = state[j];
+		state[j] = t;
+		buffer[idx] = state[(state[i] + state[j]) % 256];
+	}
+
+	return i;
+}
+
+EXPORT int benchmark_arcfour(uint32_t iterations) {
+	const int keyLength = 5;
+	const int streamLength = 10;
+
+	uint8_t* state = (uint8_t*)MALLOC(256, 8);
+	uint8_t* buffer = (uint8_t*)MALLOC(64, 8);
+	uint8_t key[keyLength];
+	uint8_t stream[streamLength];
+
+	key[0] = 0xDB;
+	key[1] = 0xB7;
+	key[2] = 0x60;
+	key[3] = 0xD4;
+	key[4] = 0x56;
+
+	stream[0] = 0xEB;
+	stream[1] = 0x9F;
+	stream[2] = 0x77;
+	stream[3] = 0x81;
+	stream[4] = 0xB7;
+	stream[5] = 0x34;
+	stream[6] = 0xCA;
+	stream[7] = 0x72;
+	stream[8] = 0xA7;
+	stream[9] = 0x19;
+
+	int idx = 0;
+
+	for (uint32_t i = 0; i < iterations; i++) {
+		HISTOGRAM_BEGIN();
+
+		idx = benchmark_arcfour_key_setup(state, key, keyLength);
+		idx = benchmark_arcfour_generate_stream(state, buffer, streamLength);
+
+		HISTOGRAM_END();
+	}
+
+	FREE(state);
+	FREE(buffer);
+
+	return idx;
+}
+
+// The index above is always the stream length, so compilers may discard the kernel; the specialized comparison folds the keystream into the result instead
+
+static int benchmark_arcfour_keystream(uint32_t iterations) {
+	const int keyLength = 5;
+	const int streamLength = 10;
+
+	uint8_t* state = (uint8_t*)MALLOC(256, 8);
+	uint8_t* buffer = (uint8_t*)MALLOC(64, 8);
+	uint8_t key[keyLength];
+
+	key[0] = 0xDB;
+	key[1] = 0xB7;
+	key[2] = 0x60;
+	key[3] = 0xD4;
+	key[4] = 0x56;
+
+	uint32_t fold = 0;
+
+	for (uint32_t i = 0; i < iterations; i++) {
+		benchmark_arcfour_key_setup(state, key, keyLength);
+		benchmark_arcfour_generate_stream(state, buffer, streamLength);
+
+		for (int k = 0; k < streamLength; k++) {
+			fold = fold * 31 + buffer[k];
+		}
+	}
+
+	FREE(state);
+	FREE(buffer);
+
+	return (int)fold;
+}
+
+// Seahash
+
+inline static uint64_t benchmark_seahash_read(uint8_t* pointer) {
+	return *(uint64_t*)pointer;
+}
+
+inline static uint64_t benchmark_seahash_diffuse(uint64_t value) {
+	value *= 0x6EED0E9DA4D94A4F;
+	value ^= ((value >> 32) >> (int)(value >> 60));
+	value *= 0x6EED0E9DA4D94A4F;
+
+	return value;
+}
+
+static uint64_t benchmark_seahash_compute(uint8_t* buffer, uint64_t length, uint64_t a, uint64_t b, uint64_t c, uint64_t d) {
+	const uint32_t blockSize = 32;
+
+	uint64_t end = length & ~(blockSize - 1);
+
+	for (uint32_t i = 0; i < end; i += blockSize) {
+		a ^= benchmark_seahash_read(buffer + i);
+		b ^= benchmark_seahash_read(buffer + i + 8);
+		c ^= benchmark_seahash_read(buffer + i + 16);
+		d ^= benchmark_seahash_read(buffer + i + 24);
+
+		a = benchmark_seahash_diffuse(a);
+		b = benchmark_seahash_diffuse(b);
+		c = benchmark_seahash_diffuse(c);
+		d = benchmark_seahash_diffuse(d);
+	}
+
+	uint64_t excessive = length - end;
+	uint8_t* bufferEnd = buffer + end;
+
+	if (excessive > 0) {
+		a ^= benchmark_seahash_read(bufferEnd);
+
+		if (excessive > 8) {
+			b ^= benchmark_seahash_read(bufferEnd);
+
+			if (excessive > 16) {
+				c ^= benchmark_seahash_read(bufferEnd);
+
+				if (excessive > 24) {
+					d ^= benchmark_seahash_read(bufferEnd);
+					d = benchmark_seahash_diffuse(d);
+				}
+
+				c = benchmark_seahash_diffuse(c);
+			}
+
+			b = benchmark_seahash_diffuse(b);
+		}
+
+		a = benchmark_seahash_diffuse(a);
+	}
+
+	a ^= b;
+	c ^= d;
+	a ^= c;
+	a ^= length;
+
+	return benchmark_seahash_diffuse(a);
+}
+
+inline static uint8_t* benchmark_seahash_buffer(int bufferLength) {
+	uint8_t* buffer = (uint8_t*)MALLOC(bufferLength, 8);
+
+	for (int i = 0; i < bufferLength; i++) {
+		buffer[i] = (uint8_t)(i % 256);
+	}
+
+	return buffer;
+}
+
+inline static uint64_t benchmark_seahash_run(uint32_t iterations, int bufferLength) {
+	uint8_t* buffer = benchmark_seahash_buffer(bufferLength);
+	uint64_t hash = 0;
+
+	for (uint32_t i = 0; i < iterations; i++) {
+		HISTOGRAM_BEGIN();
+
+		hash = benchmark_seahash_compute(buffer, bufferLength, 0x16F11FE89B0D677C, 0xB480A793D8E6C86C, 0x6FE2E5AAF078EBC9, 0x14F994A4C5259381);
+
+		HISTOGRAM_END();
+	}
+
+	FREE(buffer);
+
+	return hash;
+}
+
+EXPORT uint64_t benchmark_seahash(uint32_t iterations) {
+	const int bufferLength = 1024 * 128;
+
+	return benchmark_seahash_run(iterations, bufferLength);
+}
+
+EXPORT uint64_t benchmark_seahash_sized(uint32_t iterations, uint32_t bufferLength) {
+	return benchmark_seahash_run(iterations, (int)bufferLength);
+}
+
+// Radix
+
+static THREAD_LOCAL uint32_t classicRandom;
+
+inline static int benchmark_radix_random(void) {
+	classicRandom = (6253729 * classicRandom + 4396403);
+
+	return (int)(classicRandom % 32767);
+}
+
+inline static int benchmark_radix_find_largest(int* array, int length) {
+	int i;
+	int largest = -1;
+
+	for (i = 0; i < length; i++) {
+		if (array[i] > largest)
+			largest = array[i];
+	}
+
+	return largest;
+}
+
+inline static void benchmark_radix_sort_buffered(int* array, int* semiSorted, int length) {
+	int i;
+	int significantDigit = 1;
+	int largest = benchmark_radix_find_largest(array, length);
+
+	while (largest / significantDigit > 0) {
+		int bucket[10] = { 0 };
+
+		for (i = 0; i < length; i++) {
+			bucket[(array[i] / significantDigit) % 10]++;
+		}
+
+		for (i = 1; i < 10; i++) {
+			bucket[i] += bucket[i - 1];
+		}
+
+		for (i = length - 1; i >= 0; i--) {
+			semiSorted[--bucket[(array[i] / significantDigit) % 10]] = array[i];
+		}
+
+		for (i = 0; i < length; i++) {
+			array[i] = semiSorted[i];
+		}
+
+		significantDigit *= 10;
+	}
+}
+
+static void benchmark_radix_sort(int* array, int length) {
+	ALLOCA(int, semiSorted, length);
+
+	benchmark_radix_sort_buffered(array, semiSorted, length);
+}
+
+EXPORT int benchmark_radix(uint32_t iterations) {
+	classicRandom = 7525;
+
+	const int arrayLength = 128;
+
+	int* array = (int*)MALLOC(arrayLength * sizeof(int), 16);
+
+	for (uint32_t a = 0; a < iterations; a++) {
+		HISTOGRAM_BEGIN();
+
+		for (int b = 0; b < arrayLength; b++) {
+			array[b] = benchmark_radix_random();
+		}
+
+		benchmark_radix_sort(array, arrayLength);
+
+		HISTOGRAM_END();
+	}
+
+	int head = array[0];
+
+	FREE(array);
+
+	return head;
+}
+
+EXPORT int benchmark_radix_sized(uint32_t iterations, uint32_t arrayLength) {
+	classicRandom = 7525;
+
+	int* array = (int*)MALLOC(arrayLength * sizeof(int), 16);
+	int* semiSorted = (int*)MALLOC(arrayLength * sizeof(int), 16);
+
+	for (uint32_t a = 0; a < iterations; a++) {
+		for (uint32_t b = 0; b < arrayLength; b++) {
+			array[b] = benchmark_radix_random();
+		}
+
+		benchmark_radix_sort_buffered(array, semiSorted, (int)arrayLength);
+	}
+
+	int head = array[0];
+
+	FREE(array);
+	FREE(semiSorted);
+
+	return head;
+}
+
+// SGEMM
+
+#define SGEMM_MC 64
+#define SGEMM_KC 256
+#define SGEMM_NC 512
+
+#if defined(__AVX512F__)
+	#define SGEMM_VECTOR 16
+	#define SGEMM_LOAD(pointer) _mm512_load_ps(pointer)
+	#define SGEMM_LOADU(pointer) _mm512_loadu_ps(pointer)
+	#define SGEMM_STOREU(pointer, vector) _mm512_storeu_ps(pointer, vector)
+	#define SGEMM_BROADCAST(value) _mm512_set1_ps(value)
+	#define SGEMM_ZERO() _mm512_setzero_ps()
+	#define SGEMM_ADD(left, right) _mm512_add_ps(left, right)
+	#define SGEMM_FMA(a, b, c) _mm512_fmadd_ps(a, b, c)
+
+	typedef __m512 SgemmVector;
+#elif defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+	#define SGEMM_VECTOR 8
+	#define SGEMM_LOAD(pointer) _mm256_load_ps(pointer)
+	#define SGEMM_LOADU(pointer) _mm256_loadu_ps(pointer)
+	#define SGEMM_STOREU(pointer, vector) _mm256_storeu_ps(pointer, vector)
+	#define SGEMM_BROADCAST(value) _mm256_set1_ps(value)
+	#define SGEMM_ZERO() _mm256_setzero_ps()
+	#define SGEMM_ADD(left, right) _mm256_add_ps(left, right)
+	#define SGEMM_FMA(a, b, c) _mm256_fmadd_ps(a, b, c)
+
+	typedef __m256 SgemmVector;
+#else
+	#define SGEMM_VECTOR 0
+#endif
+
+#define SGEMM_MR 6
+#define SGEMM_NR (2 * SGEMM_VECTOR)
+
+typedef enum _SgemmVariant {
+	SGEMM_NAIVE = 0,
+	SGEMM_BLOCKED = 1,
+	SGEMM_MICROKERNEL = 2
+} SgemmVariant;
+
+typedef struct _SgemmTask {
+	const float* a;
+	const float* b;
+	float* c;
+	uint32_t size, rowBegin, rowEnd, iterations, variant;
+	int processor, pinned;
+} SgemmTask;
+
+// The inputs are small multiples of a quarter, so every product and partial sum is exact and all variants agree bit for bit regardless of the summation order
+
+inline static void benchmark_sgemm_initialize(float* a, float* b, float* c, uint32_t size) {
+	for (uint32_t i = 0; i < size; i++) {
+		for (uint32_t j = 0; j < size; j++) {
+			a[i * size + j] = (float)((int)((i * 3 + j) % 8) - 4) * 0.5f;
+			b[i * size + j] = (float)((int)((i + j * 5) % 8) - 4) * 0.25f;
+			c[i * size + j] = 0.0f;
+		}
+	}
+}
+
+inline static float benchmark_sgemm_trace(const float* c, uint32_t size) {
+	double trace = 0.0;
+
+	for (uint32_t i = 0; i < size; i++) {
+		trace += c[i * size + i];
+	}
+
+	return (float)trace;
+}
+
+inline static uint32_t benchmark_sgemm_min(uint32_t left, uint32_t right) {
+	return left < right ? left : right;
+}
+
+static void benchmark_sgemm_naive(const float* a, const float* b, float* c, uint32_t size, uint32_t rowBegin, uint32_t rowEnd) {
+	for (uint32_t i = rowBegin; i < rowEnd; i++) {
+		for (uint32_t j = 0; j < size; j++) {
+			float sum = c[i * size + j];
+
+			for (uint32_t k = 0; k < size; k++) {
+				sum += a[i * size + k] * b[k * size + j];
+			}
+
+			c[i * size + j] = sum;
+		}
+	}
+}
+
+// Blocks of B stay in the last-level cache and blocks of A in L2, the rows of the output are updated with contiguous panels of B
+
+static void benchmark_sgemm_blocked(const float* a, const float* b, float* c, uint32_t size, uint32_t rowBegin, uint32_t rowEnd, float* packedA, float* packedB) {
+	for (uint32_t jj = 0; jj < size; jj += SGEMM_NC) {
+		uint32_t nc = benchmark_sgemm_min(SGEMM_NC, size - jj);
+
+		for (uint32_t kk = 0; kk < size; kk += SGEMM_KC) {
+			uint32_t kc = benchmark_sgemm_min(SGEMM_KC, size - kk);
+
+			for (uint32_t k = 0; k < kc; k++) {
+				for (uint32_t j = 0; j < nc; j++) {
+					packedB[k * nc + j] = b[(kk + k) * size + jj + j];
+				}
+			}
+
+			for (uint32_t ii = rowBegin; ii < rowEnd; ii += SGEMM_MC) {
+				uint32_t mc = benchmark_sgemm_min(SGEMM_MC, rowEnd - ii);
+
+				for (uint32_t i = 0; i < mc; i++) {
+					for (uint32_t k = 0; k < kc; k++) {
+						packedA[i * kc + k] = a[(ii + i) * size + kk + k];
+					}
+				}
+
+				for (uint32_t i = 0; i < mc; i++) {
+					float* row = &c[(ii + i) * size + jj];
+
+					for (uint32_t k = 0; k < kc; k++) {
+						float scalar = packedA[i * kc + k];
+						const float* panel = &packedB[k * nc];
+
+						for (uint32_t j = 0; j < nc; j++) {
+							row[j] += scalar * panel[j];
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+#if SGEMM_VECTOR > 0
+	// Accumulates a SGEMM_MR x SGEMM_NR tile in registers over the packed panels, partial tiles at the edges go through a scratch tile
+
+	static void benchmark_sgemm_tile(const float* packedA, const float* packedB, uint32_t kc, float* c, uint32_t stride, uint32_t rows, uint32_t columns) {
+		SgemmVector accumulators[SGEMM_MR][2];
+
+		for (int r = 0; r < SGEMM_MR; r++) {
+			accumulators[r][0] = SGEMM_ZERO();
+			accumulators[r][1] = SGEMM_ZERO();
+		}
+
+		for (uint32_t k = 0; k < kc; k++) {
+			SgemmVector b0 = SGEMM_LOAD(&packedB[k * SGEMM_NR]);
+			SgemmVector b1 = SGEMM_LOAD(&packedB[k * SGEMM_NR + SGEMM_VECTOR]);
+
+			for (int r = 0; r < SGEMM_MR; r++) {
+				SgemmVector a = SGEMM_BROADCAST(packedA[k * SGEMM_MR + r]);
+
+				accumulators[r][0] = SGEMM_FMA(a, b0, accumulators[r][0]);
+				accumulators[r][1] = SGEMM_FMA(a, b1, accumulators[r][1]);
+			}
+		}
+
+		if (rows == SGEMM_MR && columns == SGEMM_NR) {
+			for (int r = 0; r < SGEMM_MR; r++) {
+				float* row = &c[r * stride];
+
+				SGEMM_STOREU(row, SGEMM_ADD(SGEMM_LOADU(row), accumulators[r][0]));
+				SGEMM_STOREU(row + SGEMM_VECTOR, SGEMM_ADD(SGEMM_LOADU(row + SGEMM_VECTOR), accumulators[r][1]));
+			}
+		} else {
+			float tile[SGEMM_MR * SGEMM_NR];
+
+			for (int r = 0; r < SGEMM_MR; r++) {
+				SGEMM_STOREU(&tile[r * SGEMM_NR], accumulators[r][0]);
+				SGEMM_STOREU(&tile[r * SGEMM_NR + SGEMM_VECTOR], accumulators[r][1]);
+			}
+
+			for (uint32_t r = 0; r < rows; r++) {
+				for (uint32_t j = 0; j < columns; j++) {
+					c[r * stride + j] += tile[r * SGEMM_NR + j];
+				}
+			}
+		}
+	}
+
+	// Same blocking as above, but A is packed into SGEMM_MR-row panels and B into SGEMM_NR-column panels in the order the tile consumes them, padded with zeros
+
+	static void benchmark_sgemm_microkernel(const float* a, const float* b, float* c, uint32_t size, uint32_t rowBegin, uint32_t rowEnd, float* packedA, float* packedB) {
+		for (uint32_t jj = 0; jj < size; jj += SGEMM_NC) {
+			uint32_t nc = benchmark_sgemm_min(SGEMM_NC, size - jj);
+
+			for (uint32_t kk = 0; kk < size; kk += SGEMM_KC) {
+				uint32_t kc = benchmark_sgemm_min(SGEMM_KC, size - kk);
+
+				for (uint32_t jr = 0; jr < nc; jr += SGEMM_NR) {
+					float* panel = &packedB[jr * kc];
+
+					for (uint32_t k = 0; k < kc; k++) {
+						for (uint32_t j = 0; j < SGEMM_NR; j++) {
+							panel[k * SGEMM_NR + j] = jr + j < nc ? b[(kk + k) * size + jj + jr + j] : 0.0f;
+						}
+					}
+				}
+
+				for (uint32_t ii = rowBegin; ii < rowEnd; ii += SGEMM_MC) {
+					uint32_t mc = benchmark_sgemm_min(SGEMM_MC, rowEnd - ii);
+
+					for (uint32_t ir = 0; ir < mc; ir += SGEMM_MR) {
+						float* panel = &packedA[ir * kc];
+
+						for (uint32_t k = 0; k < kc; k++) {
+							for (uint32_t r = 0; r < SGEMM_MR; r++) {
+								panel[k * SGEMM_MR + r] = ir + r < mc ? a[(ii + ir + r) * size + kk + k] : 0.0f;
+							}
+						}
+					}
+
+					for (uint32_t ir = 0; ir < mc; ir += SGEMM_MR) {
+						for (uint32_t jr = 0; jr < nc; jr += SGEMM_NR) {
+							benchmark_sgemm_tile(&packedA[ir * kc], &packedB[jr * kc], kc, &c[(ii + ir) * size + jj + jr], size, benchmark_sgemm_min(SGEMM_MR, mc - ir), benchmark_sgemm_min(SGEMM_NR, nc - jr));
+						}
+					}
+				}
+			}
+		}
+	}
+#endif
+
+static void benchmark_sgemm_task(SgemmTask* task) {
+	// Panels are rounded up to whole tiles for the micro-kernel
+
+	float* packedA = (float*)MALLOC((SGEMM_MC + SGEMM_MR) * SGEMM_KC * sizeof(float), 64);
+	float* packedB = (float*)MALLOC((SGEMM_NC + SGEMM_NR) * SGEMM_KC * sizeof(float), 64);
+
+	for (uint32_t i = 0; i < task->iterations; i++) {
+		switch (task->variant) {
+			case SGEMM_NAIVE:
+				benchmark_sgemm_naive(task->a, task->b, task->c, task->size, task->rowBegin, task->rowEnd);
+				break;
+
+			#if SGEMM_VECTOR > 0
+				case SGEMM_MICROKERNEL:
+					benchmark_sgemm_microkernel(task->a, task->b, task->c, task->size, task->rowBegin, task->rowEnd, packedA, packedB);
+					break;
+			#endif
+
+			default:
+				benchmark_sgemm_blocked(task->a, task->b, task->c, task->size, task->rowBegin, task->rowEnd, packedA, packedB);
+				break;
+		}
+	}
+
+	FREE(packedA);
+	FREE(packedB);
 }
 
-inline static Vector benchmark_pixar_raytracer_add_float(Vector vector, float value) {
-	vector.x += value;
-	vector.y += value;
-	vector.z += value;
+#if defined(__linux__)
+	static void* benchmark_sgemm_thread(void* task) {
+		SgemmTask* sgemmTask = (SgemmTask*)task;
 
-	return vector;
+		sgemmTask->pinned = sgemmTask->processor < 0 || benchmark_runner_pin(sgemmTask->processor);
+
+		benchmark_sgemm_task(sgemmTask);
+
+		return NULL;
+	}
+#elif defined(_WIN32)
+	static DWORD WINAPI benchmark_sgemm_thread(LPVOID task) {
+		SgemmTask* sgemmTask = (SgemmTask*)task;
+
+		sgemmTask->pinned = sgemmTask->processor < 0 || benchmark_runner_pin(sgemmTask->processor);
+
+		benchmark_sgemm_task(sgemmTask);
+
+		return 0;
+	}
+#endif
+
+EXPORT float benchmark_sgemm(uint32_t size, uint32_t iterations) {
+	float* a = (float*)MALLOC(size * size * sizeof(float), 64);
+	float* b = (float*)MALLOC(size * size * sizeof(float), 64);
+	float* c = (float*)MALLOC(size * size * sizeof(float), 64);
+	float* packedA = (float*)MALLOC(SGEMM_MC * SGEMM_KC * sizeof(float), 64);
+	float* packedB = (float*)MALLOC(SGEMM_KC * SGEMM_NC * sizeof(float), 64);
+
+	benchmark_sgemm_initialize(a, b, c, size);
+
+	for (uint32_t i = 0; i < iterations; i++) {
+		HISTOGRAM_BEGIN();
+
+		benchmark_sgemm_blocked(a, b, c, size, 0, size, packedA, packedB);
+
+		HISTOGRAM_END();
+	}
+
+	float trace = benchmark_sgemm_trace(c, size);
+
+	FREE(a);
+	FREE(b);
+	FREE(c);
+	FREE(packedA);
+	FREE(packedB);
+
+	return trace;
 }
 
-inline static Vector benchmark_pixar_raytracer_cross(Vector to, Vector from) {
-	Vector vector = { 0 };
+// Floats per vector of the register-tiled micro-kernel, 0 when the library was built without AVX2 and FMA and the variant falls back to the blocked one
 
-	vector.x = to.y * from.z - to.z * from.y;
-	vector.y = to.z * from.x - to.x * from.z;
-	vector.z = to.x * from.y - to.y * from.x;
+EXPORT uint32_t benchmark_sgemm_vector_width(void) {
+	return SGEMM_VECTOR;
+}
 
-	return vector;
+// Splits the rows of the output across the given number of threads, each packing its own panels and pinned to the matching entry of the processors unless they are null, and returns the trace of the product or NaN when a thread could not be started or pinned
+
+EXPORT float benchmark_sgemm_variant(uint32_t size, uint32_t iterations, uint32_t variant, uint32_t threads, const int* processors) {
+	float* a = (float*)MALLOC(size * size * sizeof(float), 64);
+	float* b = (float*)MALLOC(size * size * sizeof(float), 64);
+	float* c = (float*)MALLOC(size * size * sizeof(float), 64);
+
+	#if defined(__linux__) || defined(_WIN32)
+		const uint32_t maximumThreads = 256;
+	#else
+		const uint32_t maximumThreads = 1;
+	#endif
+
+	SgemmTask tasks[256];
+
+	if (threads < 1)
+		threads = 1;
+
+	if (threads > maximumThreads)
+		threads = maximumThreads;
+
+	uint32_t rows = (size + threads - 1) / threads;
+
+	benchmark_sgemm_initialize(a, b, c, size);
+
+	for (uint32_t t = 0; t < threads; t++) {
+		tasks[t] = STRUCT_INIT(SgemmTask) { a, b, c, size, benchmark_sgemm_min(t * rows, size), benchmark_sgemm_min((t + 1) * rows, size), iterations, variant, processors != NULL ? processors[t] : -1, 1 };
+	}
+
+	// Every task runs on a thread of its own, so the workers do not inherit the single processor the caller is pinned to
+
+	uint32_t started = 0;
+
+	#if defined(__linux__)
+		pthread_t workers[256];
+
+		for (; started < threads; started++) {
+			if (pthread_create(&workers[started], NULL, benchmark_sgemm_thread, &tasks[started]) != 0)
+				break;
+		}
+
+		for (uint32_t t = 0; t < started; t++) {
+			pthread_join(workers[t], NULL);
+		}
+	#elif defined(_WIN32)
+		HANDLE workers[256];
+
+		for (; started < threads; started++) {
+			workers[started] = CreateThread(NULL, 0, benchmark_sgemm_thread, &tasks[started], 0, NULL);
+
+			if (workers[started] == NULL)
+				break;
+		}
+
+		for (uint32_t t = 0; t < started; t++) {
+			WaitForSingleObject(workers[t], INFINITE);
+			CloseHandle(workers[t]);
+		}
+	#else
+		benchmark_sgemm_task(&tasks[0]);
+
+		started = 1;
+	#endif
+
+	int completed = started == threads;
+
+	for (uint32_t t = 0; t < started; t++) {
+		completed &= tasks[t].pinned;
+	}
+
+	float trace = completed ? benchmark_sgemm_trace(c, size) : NAN;
+
+	FREE(a);
+	FREE(b);
+	FREE(c);
+
+	return trace;
 }
 
-inline static float benchmark_pixar_raytracer_min(float left, float right) {
-	return left < right ? left : right;
+// Latency
+
+#define LATENCY_LINE 64
+#define LATENCY_HUGE_PAGE (2 * 1024 * 1024)
+#define LATENCY_CHAINS 16
+
+typedef struct _LatencyNode {
+	struct _LatencyNode* next;
+	struct _LatencyNode* ahead;
+	uint8_t padding[LATENCY_LINE - 2 * sizeof(void*)];
+} LatencyNode;
+
+static volatile uintptr_t latencySink;
+
+// Small pages are enforced with MADV_NOHUGEPAGE, huge pages come from the reserved pool or transparent huge pages on Linux and from large pages on Windows (SeLockMemoryPrivilege required)
+
+static void* benchmark_latency_allocate(size_t size, int huge, size_t* mapped) {
+	#if defined(__linux__)
+		void* memory = MAP_FAILED;
+
+		if (huge) {
+			*mapped = (size + LATENCY_HUGE_PAGE - 1) & ~(size_t)(LATENCY_HUGE_PAGE - 1);
+			memory = mmap(NULL, *mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+			if (memory != MAP_FAILED)
+				return memory;
+
+			char policy[64] = { 0 };
+			FILE* file = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+
+			if (file == NULL)
+				return NULL;
+
+			int read = fgets(policy, sizeof(policy), file) != NULL;
+
+			fclose(file);
+
+			if (!read || strstr(policy, "[never]") != NULL)
+				return NULL;
+
+			memory = mmap(NULL, *mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+			if (memory != MAP_FAILED && ((uintptr_t)memory & (LATENCY_HUGE_PAGE - 1)) != 0) {
+				munmap(memory, *mapped);
+
+				// Over-allocates and trims, so the region starts on a huge page boundary
+
+				size_t padded = *mapped + LATENCY_HUGE_PAGE;
+				uint8_t* base = (uint8_t*)mmap(NULL, padded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+				if (base == (uint8_t*)MAP_FAILED)
+					return NULL;
+
+				uint8_t* aligned = (uint8_t*)(((uintptr_t)base + LATENCY_HUGE_PAGE - 1) & ~(uintptr_t)(LATENCY_HUGE_PAGE - 1));
+
+				if (aligned > base)
+					munmap(base, aligned - base);
+
+				munmap(aligned + *mapped, base + padded - (aligned + *mapped));
+				memory = aligned;
+			}
+
+			if (memory == MAP_FAILED || madvise(memory, *mapped, MADV_HUGEPAGE) != 0) {
+				if (memory != MAP_FAILED)
+					munmap(memory, *mapped);
+
+				return NULL;
+			}
+
+			return memory;
+		}
+
+		*mapped = size;
+		memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+		if (memory == MAP_FAILED)
+			return NULL;
+
+		madvise(memory, size, MADV_NOHUGEPAGE);
+
+		return memory;
+	#elif defined(_WIN32)
+		if (huge) {
+			size_t page = GetLargePageMinimum();
+
+			if (page == 0)
+				return NULL;
+
+			*mapped = (size + page - 1) & ~(page - 1);
+
+			return VirtualAlloc(NULL, *mapped, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+		}
+
+		*mapped = size;
+
+		return VirtualAlloc(NULL, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+	#else
+		if (huge)
+			return NULL;
+
+		*mapped = size;
+
+		return MALLOC(size, LATENCY_LINE);
+	#endif
 }
 
-inline static float benchmark_pixar_raytracer_box_test(Vector position, Vector lowerLeft, Vector upperRight) {
-	lowerLeft = benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(position, lowerLeft), -1);
-	upperRight = benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(upperRight, position), -1);
+static void benchmark_latency_free(void* memory, size_t mapped) {
+	#if defined(__linux__)
+		munmap(memory, mapped);
+	#elif defined(_WIN32)
+		(void)mapped;
 
-	return -benchmark_pixar_raytracer_min(benchmark_pixar_raytracer_min(benchmark_pixar_raytracer_min(lowerLeft.x, upperRight.x), benchmark_pixar_raytracer_min(lowerLeft.y, upperRight.y)), benchmark_pixar_raytracer_min(lowerLeft.z, upperRight.z));
+		VirtualFree(memory, 0, MEM_RELEASE);
+	#else
+		(void)mapped;
+
+		FREE(memory);
+	#endif
 }
 
-inline static float benchmark_pixar_raytracer_random(void) {
-	marsagliaZ = 36969 * (marsagliaZ & 65535) + (marsagliaZ >> 16);
-	marsagliaW = 18000 * (marsagliaW & 65535) + (marsagliaW >> 16);
+// Every step issues one dependent load per chain, a constant chain count lets the compiler keep all cursors in registers
 
-	return ((marsagliaZ << 16) + marsagliaW) * 2.0f / 10000000000.0f;
+inline static void benchmark_latency_chase(LatencyNode** cursors, uint32_t chains, uint64_t steps, int prefetch) {
+	LatencyNode* chain[LATENCY_CHAINS];
+
+	for (uint32_t c = 0; c < chains; c++) {
+		chain[c] = cursors[c];
+	}
+
+	for (uint64_t s = 0; s < steps; s++) {
+		for (uint32_t c = 0; c < chains; c++) {
+			if (prefetch)
+				_mm_prefetch((const char*)chain[c]->ahead, _MM_HINT_T0);
+
+			chain[c] = chain[c]->next;
+		}
+	}
+
+	for (uint32_t c = 0; c < chains; c++) {
+		cursors[c] = chain[c];
+	}
 }
 
-static float benchmark_pixar_raytracer_sample(Vector position, int* hitType) {
-	const int size = 60;
+static void benchmark_latency_dispatch(LatencyNode** cursors, uint32_t chains, uint64_t steps, int prefetch) {
+	switch (chains) {
+		case 1:
+			benchmark_latency_chase(cursors, 1, steps, prefetch);
+			break;
 
-	float distance = 1e9f;
-	Vector f = position;
-	uint8_t letters[size];
+		case 2:
+			benchmark_latency_chase(cursors, 2, steps, prefetch);
+			break;
 
-	// P              // I              // X              // A              // R
-	letters[0]  = 53; letters[12] = 65; letters[24] = 73; letters[32] = 85; letters[44] = 97; letters[56] = 99;
-	letters[1]  = 79; letters[13] = 79; letters[25] = 79; letters[33] = 79; letters[45] = 79; letters[57] = 87;
-	letters[2]  = 53; letters[14] = 69; letters[26] = 81; letters[34] = 89; letters[46] = 97; letters[58] = 105;
-	letters[3]  = 95; letters[15] = 79; letters[27] = 95; letters[35] = 95; letters[47] = 95; letters[59] = 79;
-	letters[4]  = 53; letters[16] = 67; letters[28] = 73; letters[36] = 89; letters[48] = 97;
-	letters[5]  = 87; letters[17] = 79; letters[29] = 95; letters[37] = 95; letters[49] = 87;
-	letters[6]  = 57; letters[18] = 67; letters[30] = 81; letters[38] = 93; letters[50] = 101;
-	letters[7]  = 87; letters[19] = 95; letters[31] = 79; letters[39] = 79; letters[51] = 87;
-	letters[8]  = 53; letters[20] = 65;                   letters[40] = 87; letters[52] = 97;
-	letters[9]  = 95; letters[21] = 95;                   letters[41] = 87; letters[53] = 95;
-	letters[10] = 57; letters[22] = 69;                   letters[42] = 91; letters[54] = 101;
-	letters[11] = 95; letters[23] = 95;                   letters[43] = 87; letters[55] = 95;
+		case 4:
+			benchmark_latency_chase(cursors, 4, steps, prefetch);
+			break;
+
+		case 8:
+			benchmark_latency_chase(cursors, 8, steps, prefetch);
+			break;
+
+		case 16:
+			benchmark_latency_chase(cursors, 16, steps, prefetch);
+			break;
+
+		default:
+			benchmark_latency_chase(cursors, chains, steps, prefetch);
+			break;
+	}
+}
+
+// Chases a random cyclic permutation of cache lines filling the given size with 1 to 16 chains started at even distances along the cycle, optionally prefetching the node the given number of hops ahead, and returns nanoseconds per load or a negative value when the requested pages are not available
+
+EXPORT double benchmark_latency(uint64_t size, uint32_t chains, uint32_t lookahead, int hugePages, uint64_t loads) {
+	size_t mapped = 0;
+	uint64_t count = size / LATENCY_LINE;
+
+	if (chains < 1)
+		chains = 1;
+
+	if (chains > LATENCY_CHAINS)
+		chains = LATENCY_CHAINS;
+
+	if (count < chains)
+		return -1.0;
+
+	LatencyNode* nodes = (LatencyNode*)benchmark_latency_allocate(count * sizeof(LatencyNode), hugePages, &mapped);
+
+	if (nodes == NULL)
+		return -1.0;
+
+	uint32_t* order = (uint32_t*)MALLOC(count * sizeof(uint32_t), 16);
+	uint64_t random = 0x9E3779B97F4A7C15ULL;
+
+	for (uint64_t i = 0; i < count; i++) {
+		order[i] = (uint32_t)i;
+	}
+
+	// Sattolo's algorithm yields a single cycle through every node
+
+	for (uint64_t i = count - 1; i > 0; i--) {
+		random ^= random << 13;
+		random ^= random >> 7;
+		random ^= random << 17;
+
+		uint64_t j = random % i;
+		uint32_t swap = order[i];
+
+		order[i] = order[j];
+		order[j] = swap;
+	}
+
+	for (uint64_t i = 0; i < count; i++) {
+		nodes[order[i]].next = &nodes[order[(i + 1) % count]];
+		nodes[order[i]].ahead = &nodes[order[(i + lookahead) % count]];
+	}
+
+	LatencyNode* cursors[LATENCY_CHAINS];
+
+	for (uint32_t c = 0; c < chains; c++) {
+		cursors[c] = &nodes[order[count * c / chains]];
+	}
+
+	FREE(order);
+
+	uint64_t steps = loads / chains;
+
+	benchmark_latency_dispatch(cursors, chains, count / chains, lookahead > 0);
+
+	uint64_t nanoseconds = benchmark_runner_nanoseconds();
+
+	benchmark_latency_dispatch(cursors, chains, steps, lookahead > 0);
+
+	nanoseconds = benchmark_runner_nanoseconds() - nanoseconds;
+
+	for (uint32_t c = 0; c < chains; c++) {
+		latencySink ^= (uintptr_t)cursors[c];
+	}
+
+	benchmark_latency_free(nodes, mapped);
+
+	return (double)nanoseconds / (double)(steps * chains);
+}
+
+// Scan
+
+#if defined(__AVX2__)
+	#define SCAN_VECTOR 32
+	#define SCAN_LOAD(pointer) _mm256_loadu_si256((const __m256i*)(pointer))
+	#define SCAN_SET(value) _mm256_set1_epi8((char)(value))
+	#define SCAN_SET32(value) _mm256_set1_epi32(value)
+	#define SCAN_TABLE(...) _mm256_broadcastsi128_si256(_mm_setr_epi8(__VA_ARGS__))
+	#define SCAN_SHUFFLE(table, indices) _mm256_shuffle_epi8(table, indices)
+	#define SCAN_AND(left, right) _mm256_and_si256(left, right)
+	#define SCAN_OR(left, right) _mm256_or_si256(left, right)
+	#define SCAN_XOR(left, right) _mm256_xor_si256(left, right)
+	#define SCAN_ADD(left, right) _mm256_add_epi8(left, right)
+	#define SCAN_EQUAL(left, right) _mm256_cmpeq_epi8(left, right)
+	#define SCAN_GREATER(left, right) _mm256_cmpgt_epi8(left, right)
+	#define SCAN_SUBTRACT_SATURATED(left, right) _mm256_subs_epu8(left, right)
+	#define SCAN_NIBBLES(vector) _mm256_and_si256(_mm256_srli_epi16(vector, 4), _mm256_set1_epi8(0x0F))
+	#define SCAN_MULTIPLY_HIGH(left, right) _mm256_mulhi_epu16(left, right)
+	#define SCAN_MULTIPLY_LOW(left, right) _mm256_mullo_epi16(left, right)
+	#define SCAN_MULTIPLY_ADD_BYTES(left, right) _mm256_maddubs_epi16(left, right)
+	#define SCAN_MULTIPLY_ADD(left, right) _mm256_madd_epi16(left, right)
+	#define SCAN_MASK(vector) (uint32_t)_mm256_movemask_epi8(vector)
+	#define SCAN_ZERO(vector) _mm256_testz_si256(vector, vector)
+	#define SCAN_PREVIOUS(current, previous, count) _mm256_alignr_epi8(current, _mm256_permute2x128_si256(previous, current, 0x21), 16 - (count))
+	#define SCAN_LOAD_TRIPLETS(pointer) _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(pointer))), _mm_loadu_si128((const __m128i*)((pointer) + 12)), 1)
+	#define SCAN_STORE(pointer, vector) _mm256_storeu_si256((__m256i*)(pointer), vector)
+	#define SCAN_STORE_TRIPLETS(pointer, vector) (_mm_storeu_si128((__m128i*)(pointer), _mm256_castsi256_si128(vector)), _mm_storeu_si128((__m128i*)((pointer) + 12), _mm256_extracti128_si256(vector, 1)))
+
+	typedef __m256i ScanVector;
+#elif defined(__SSE4_2__)
+	#define SCAN_VECTOR 16
+	#define SCAN_LOAD(pointer) _mm_loadu_si128((const __m128i*)(pointer))
+	#define SCAN_SET(value) _mm_set1_epi8((char)(value))
+	#define SCAN_SET32(value) _mm_set1_epi32(value)
+	#define SCAN_TABLE(...) _mm_setr_epi8(__VA_ARGS__)
+	#define SCAN_SHUFFLE(table, indices) _mm_shuffle_epi8(table, indices)
+	#define SCAN_AND(left, right) _mm_and_si128(left, right)
+	#define SCAN_OR(left, right) _mm_or_si128(left, right)
+	#define SCAN_XOR(left, right) _mm_xor_si128(left, right)
+	#define SCAN_ADD(left, right) _mm_add_epi8(left, right)
+	#define SCAN_EQUAL(left, right) _mm_cmpeq_epi8(left, right)
+	#define SCAN_GREATER(left, right) _mm_cmpgt_epi8(left, right)
+	#define SCAN_SUBTRACT_SATURATED(left, right) _mm_subs_epu8(left, right)
+	#define SCAN_NIBBLES(vector) _mm_and_si128(_mm_srli_epi16(vector, 4), _mm_set1_epi8(0x0F))
+	#define SCAN_MULTIPLY_HIGH(left, right) _mm_mulhi_epu16(left, right)
+	#define SCAN_MULTIPLY_LOW(left, right) _mm_mullo_epi16(left, right)
+	#define SCAN_MULTIPLY_ADD_BYTES(left, right) _mm_maddubs_epi16(left, right)
+	#define SCAN_MULTIPLY_ADD(left, right) _mm_madd_epi16(left, right)
+	#define SCAN_MASK(vector) (uint32_t)_mm_movemask_epi8(vector)
+	#define SCAN_ZERO(vector) _mm_testz_si128(vector, vector)
+	#define SCAN_PREVIOUS(current, previous, count) _mm_alignr_epi8(current, previous, 16 - (count))
+	#define SCAN_LOAD_TRIPLETS(pointer) _mm_loadu_si128((const __m128i*)(pointer))
+	#define SCAN_STORE(pointer, vector) _mm_storeu_si128((__m128i*)(pointer), vector)
+	#define SCAN_STORE_TRIPLETS(pointer, vector) _mm_storeu_si128((__m128i*)(pointer), vector)
+
+	typedef __m128i ScanVector;
+#else
+	#define SCAN_VECTOR 0
+#endif
+
+// Bytes of output a base64 or any other kernel may write past the produced length
+
+#define SCAN_SLACK 64
+
+typedef enum _ScanKernel {
+	SCAN_DELIMITERS = 0,
+	SCAN_SEARCH = 1,
+	SCAN_BASE64 = 2,
+	SCAN_UTF8 = 3
+} ScanKernel;
+
+static const uint8_t scanNeedle[] = "needle";
+static const uint8_t scanBase64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+inline static uint32_t benchmark_scan_population(uint32_t mask) {
+	#ifdef _MSC_VER
+		return __popcnt(mask);
+	#else
+		return (uint32_t)__builtin_popcount(mask);
+	#endif
+}
+
+inline static uint32_t benchmark_scan_trailing_zeros(uint32_t mask) {
+	#ifdef _MSC_VER
+		unsigned long index;
+
+		_BitScanForward(&index, mask);
+
+		return index;
+	#else
+		return (uint32_t)__builtin_ctz(mask);
+	#endif
+}
+
+// Mixed-width UTF-8 records with delimiters and one needle per line, the remainder after the last complete line is filled with spaces
+
+static uint8_t* benchmark_scan_text(uint32_t length) {
+	static const char line[] = "id=42,name=Gr\xC3\xB6\xC3\x9F" "e,city=K\xC3\xB8" "benhavn,price=12\xE2\x82\xAC,note=\xF0\x9F\x8E\xB5 a needle in the haystack\n";
+
+	const uint32_t lineLength = sizeof(line) - 1;
+
+	uint8_t* buffer = (uint8_t*)MALLOC(length + SCAN_SLACK, 8);
+	uint32_t complete = length / lineLength * lineLength;
+
+	for (uint32_t i = 0; i < complete; i++) {
+		buffer[i] = (uint8_t)line[i % lineLength];
+	}
+
+	memset(buffer + complete, ' ', length + SCAN_SLACK - complete);
+
+	return buffer;
+}
+
+// Newlines in the upper half, commas in the lower half
+
+static uint64_t benchmark_scan_delimiters_scalar(const uint8_t* data, size_t length) {
+	uint64_t newlines = 0, commas = 0;
+
+	for (size_t i = 0; i < length; i++) {
+		newlines += data[i] == '\n';
+		commas += data[i] == ',';
+	}
+
+	return (newlines << 32) | commas;
+}
+
+static uint64_t benchmark_scan_search_scalar(const uint8_t* data, size_t length) {
+	const size_t needleLength = sizeof(scanNeedle) - 1;
+
+	uint64_t count = 0;
+
+	for (size_t i = 0; i + needleLength <= length; i++) {
+		if (data[i] == scanNeedle[0] && memcmp(data + i, scanNeedle, needleLength) == 0)
+			count++;
+	}
+
+	return count;
+}
+
+static size_t benchmark_scan_base64_encode_scalar(const uint8_t* input, size_t length, uint8_t* output) {
+	size_t i = 0, written = 0;
+
+	for (; i + 3 <= length; i += 3) {
+		uint32_t triple = ((uint32_t)input[i] << 16) | ((uint32_t)input[i + 1] << 8) | input[i + 2];
+
+		output[written++] = scanBase64Alphabet[(triple >> 18) & 63];
+		output[written++] = scanBase64Alphabet[(triple >> 12) & 63];
+		output[written++] = scanBase64Alphabet[(triple >> 6) & 63];
+		output[written++] = scanBase64Alphabet[triple & 63];
+	}
+
+	if (length - i == 1) {
+		output[written++] = scanBase64Alphabet[input[i] >> 2];
+		output[written++] = scanBase64Alphabet[(input[i] & 3) << 4];
+		output[written++] = '=';
+		output[written++] = '=';
+	} else if (length - i == 2) {
+		output[written++] = scanBase64Alphabet[input[i] >> 2];
+		output[written++] = scanBase64Alphabet[((input[i] & 3) << 4) | (input[i + 1] >> 4)];
+		output[written++] = scanBase64Alphabet[(input[i + 1] & 15) << 2];
+		output[written++] = '=';
+	}
+
+	return written;
+}
+
+inline static int benchmark_scan_base64_value(uint8_t character) {
+	if (character >= 'A' && character <= 'Z')
+		return character - 'A';
+
+	if (character >= 'a' && character <= 'z')
+		return character - 'a' + 26;
+
+	if (character >= '0' && character <= '9')
+		return character - '0' + 52;
+
+	if (character == '+')
+		return 62;
+
+	if (character == '/')
+		return 63;
+
+	return -1;
+}
+
+// Returns the decoded length or SIZE_MAX when the input is not valid base64
+
+static size_t benchmark_scan_base64_decode_scalar(const uint8_t* input, size_t length, uint8_t* output) {
+	size_t written = 0;
+
+	if (length % 4 != 0)
+		return SIZE_MAX;
+
+	for (size_t i = 0; i < length; i += 4) {
+		int a = benchmark_scan_base64_value(input[i]);
+		int b = benchmark_scan_base64_value(input[i + 1]);
+
+		if (a < 0 || b < 0)
+			return SIZE_MAX;
+
+		output[written++] = (uint8_t)((a << 2) | (b >> 4));
+
+		if (input[i + 2] == '=') {
+			if (i + 4 != length || input[i + 3] != '=')
+				return SIZE_MAX;
+
+			break;
+		}
+
+		int c = benchmark_scan_base64_value(input[i + 2]);
+
+		if (c < 0)
+			return SIZE_MAX;
+
+		output[written++] = (uint8_t)((b << 4) | (c >> 2));
+
+		if (input[i + 3] == '=') {
+			if (i + 4 != length)
+				return SIZE_MAX;
+
+			break;
+		}
 
-	f.z = 0.0f;
+		int d = benchmark_scan_base64_value(input[i + 3]);
 
-	for (int i = 0; i < size; i += 4) {
-		Vector begin = benchmark_pixar_raytracer_multiply_float(STRUCT_INIT(Vector) { letters[i] - 79.0f, letters[i + 1] - 79.0f, 0.0f }, 0.5f);
-		Vector e = benchmark_pixar_raytracer_add(benchmark_pixar_raytracer_multiply_float(STRUCT_INIT(Vector) { letters[i + 2] - 79.0f, letters[i + 3] - 79.0f, 0.0f }, 0.5f), benchmark_pixar_raytracer_multiply_float(begin, -1.0f));
-		Vector o = benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(f, benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(begin, e), benchmark_pixar_raytracer_min(-benchmark_pixar_raytracer_min(benchmark_pixar_raytracer_modulus(benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(begin, f), -1.0f), e) / benchmark_pixar_raytracer_modulus_self(e), 0.0f), 1.0f))), -1.0f);
+		if (d < 0)
+			return SIZE_MAX;
 
-		distance = benchmark_pixar_raytracer_min(distance, benchmark_pixar_raytracer_modulus_self(o));
+		output[written++] = (uint8_t)((c << 6) | d);
 	}
 
-	distance = sqrtf(distance);
+	return written;
+}
 
-	Vector curves[2] = { 0 };
+// Rejects overlong encodings, surrogates, code points above U+10FFFF and truncated sequences
 
-	curves[0] = STRUCT_INIT(Vector) { -11.0f, 6.0f, 0.0f };
-	curves[1] = STRUCT_INIT(Vector) { 11.0f, 6.0f, 0.0f };
+static int benchmark_scan_utf8_scalar(const uint8_t* data, size_t length) {
+	size_t i = 0;
 
-	for (int i = 1; i >= 0; i--) {
-		Vector o = benchmark_pixar_raytracer_add(f, benchmark_pixar_raytracer_multiply_float(curves[i], -1.0f));
-		float m = 0.0f;
+	while (i < length) {
+		uint8_t byte = data[i];
+		uint32_t size, minimum, codePoint;
 
-		if (o.x > 0.0f) {
-			m = fabsf(sqrtf(benchmark_pixar_raytracer_modulus_self(o)) - 2.0f);
-		} else {
-			if (o.y > 0.0f)
-				o.y += -2.0f;
-			else
-				o.y += 2.0f;
+		if (byte < 0x80) {
+			i++;
 
-			o.y += sqrtf(benchmark_pixar_raytracer_modulus_self(o));
+			continue;
 		}
 
-		distance = benchmark_pixar_raytracer_min(distance, m);
-	}
+		if ((byte & 0xE0) == 0xC0) {
+			size = 2;
+			minimum = 0x80;
+			codePoint = byte & 0x1F;
+		} else if ((byte & 0xF0) == 0xE0) {
+			size = 3;
+			minimum = 0x800;
+			codePoint = byte & 0x0F;
+		} else if ((byte & 0xF8) == 0xF0) {
+			size = 4;
+			minimum = 0x10000;
+			codePoint = byte & 0x07;
+		} else {
+			return 0;
+		}
 
-	distance = powf(powf(distance, 8.0f) + powf(position.z, 8.0f), 0.125f) - 0.5f;
-	*hitType = PIXAR_RAYTRACER_LETTER;
+		if (i + size > length)
+			return 0;
 
-	float roomDistance = benchmark_pixar_raytracer_min(-benchmark_pixar_raytracer_min(benchmark_pixar_raytracer_box_test(position, STRUCT_INIT(Vector) { -30.0f, -0.5f, -30.0f }, STRUCT_INIT(Vector) { 30.0f, 18.0f, 30.0f }), benchmark_pixar_raytracer_box_test(position, STRUCT_INIT(Vector) { -25.0f, -17.5f, -25.0f }, STRUCT_INIT(Vector) { 25.0f, 20.0f, 25.0f })), benchmark_pixar_raytracer_box_test(STRUCT_INIT(Vector) { fmodf(fabsf(position.x), 8), position.y, position.z }, STRUCT_INIT(Vector) { 1.5f, 18.5f, -25.0f }, STRUCT_INIT(Vector) { 6.5f, 20.0f, 25.0f }));
+		for (uint32_t j = 1; j < size; j++) {
+			if ((data[i + j] & 0xC0) != 0x80)
+				return 0;
 
-	if (roomDistance < distance) {
-		distance = roomDistance;
-		*hitType = PIXAR_RAYTRACER_WALL;
-	}
+			codePoint = (codePoint << 6) | (data[i + j] & 0x3F);
+		}
 
-	float sun = 19.9f - position.y;
+		if (codePoint < minimum || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+			return 0;
 
-	if (sun < distance) {
-		distance = sun;
-		*hitType = PIXAR_RAYTRACER_SUN;
+		i += size;
 	}
 
-	return distance;
+	return 1;
 }
 
-static int benchmark_pixar_raytracer_ray_marching(Vector origin, Vector direction, Vector* hitPosition, Vector* hitNormal) {
-	int hitType = PIXAR_RAYTRACER_NONE;
-	int noHitCount = 0;
-	float distance = 0.0f;
+#if SCAN_VECTOR > 0
+	#define SCAN_UTF8_TOO_SHORT (1 << 0)
+	#define SCAN_UTF8_TOO_LONG (1 << 1)
+	#define SCAN_UTF8_OVERLONG_3 (1 << 2)
+	#define SCAN_UTF8_TOO_LARGE (1 << 3)
+	#define SCAN_UTF8_SURROGATE (1 << 4)
+	#define SCAN_UTF8_OVERLONG_2 (1 << 5)
+	#define SCAN_UTF8_TOO_LARGE_1000 (1 << 6)
+	#define SCAN_UTF8_OVERLONG_4 (1 << 6)
+	#define SCAN_UTF8_TWO_CONTINUATIONS (1 << 7)
+	#define SCAN_UTF8_CARRY (SCAN_UTF8_TOO_SHORT | SCAN_UTF8_TOO_LONG | SCAN_UTF8_TWO_CONTINUATIONS)
+
+	// The last three bytes of a block may start a sequence that continues in the next one
+
+	static const uint8_t scanIncomplete[32] = {
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF
+	};
 
-	for (float i = 0; i < 100; i += distance) {
-		*hitPosition = benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(origin, direction), i);
-		distance = benchmark_pixar_raytracer_sample(*hitPosition, &hitType);
+	static uint64_t benchmark_scan_delimiters_vector(const uint8_t* data, size_t length) {
+		const ScanVector newline = SCAN_SET('\n');
+		const ScanVector comma = SCAN_SET(',');
 
-		if (distance < 0.01f || ++noHitCount > 99) {
-			*hitNormal = benchmark_pixar_raytracer_inverse(STRUCT_INIT(Vector) { benchmark_pixar_raytracer_sample(benchmark_pixar_raytracer_add(*hitPosition, STRUCT_INIT(Vector) { 0.01f, 0.0f, 0.0f }), &noHitCount) - distance, benchmark_pixar_raytracer_sample(benchmark_pixar_raytracer_add(*hitPosition, STRUCT_INIT(Vector) { 0.0f, 0.01f, 0.0f }), &noHitCount) - distance, benchmark_pixar_raytracer_sample(benchmark_pixar_raytracer_add(*hitPosition, STRUCT_INIT(Vector) { 0.0f, 0.0f, 0.01f }), &noHitCount) - distance });
+		uint64_t newlines = 0, commas = 0;
+		size_t i = 0;
 
-			return hitType;
+		for (; i + SCAN_VECTOR <= length; i += SCAN_VECTOR) {
+			ScanVector input = SCAN_LOAD(data + i);
+
+			newlines += benchmark_scan_population(SCAN_MASK(SCAN_EQUAL(input, newline)));
+			commas += benchmark_scan_population(SCAN_MASK(SCAN_EQUAL(input, comma)));
 		}
+
+		uint64_t tail = benchmark_scan_delimiters_scalar(data + i, length - i);
+
+		return ((newlines + (tail >> 32)) << 32) | (commas + (tail & 0xFFFFFFFF));
 	}
 
-	return PIXAR_RAYTRACER_NONE;
-}
+	// Candidates must match the first and the last character of the needle, only those are compared in full
 
-static Vector benchmark_pixar_raytracer_trace(Vector origin, Vector direction) {
-	Vector
-		sampledPosition = { 1.0f, 1.0f, 1.0f },
-		normal = { 1.0f, 1.0f, 1.0f },
-		color = { 1.0f, 1.0f, 1.0f },
-		attenuation = { 1.0f, 1.0f, 1.0f },
-		lightDirection = benchmark_pixar_raytracer_inverse(STRUCT_INIT(Vector) { 0.6f, 0.6f, 1.0f });
+	static uint64_t benchmark_scan_search_vector(const uint8_t* data, size_t length) {
+		const size_t needleLength = sizeof(scanNeedle) - 1;
+		const ScanVector first = SCAN_SET(scanNeedle[0]);
+		const ScanVector last = SCAN_SET(scanNeedle[needleLength - 1]);
 
-	for (int bounce = 3; bounce > 0; bounce--) {
-		int hitType = benchmark_pixar_raytracer_ray_marching(origin, direction, &sampledPosition, &normal);
+		uint64_t count = 0;
+		size_t i = 0;
 
-		switch (hitType) {
-			case PIXAR_RAYTRACER_NONE:
-				break;
+		for (; i + needleLength - 1 + SCAN_VECTOR <= length; i += SCAN_VECTOR) {
+			uint32_t mask = SCAN_MASK(SCAN_AND(SCAN_EQUAL(SCAN_LOAD(data + i), first), SCAN_EQUAL(SCAN_LOAD(data + i + needleLength - 1), last)));
 
-			case PIXAR_RAYTRACER_LETTER: {
-				direction = benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(direction, normal), benchmark_pixar_raytracer_modulus(normal, direction) * -2.0f);
-				origin = benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(sampledPosition, direction), 0.1f);
-				attenuation = benchmark_pixar_raytracer_multiply_float(attenuation, 0.2f);
+			while (mask != 0) {
+				uint32_t offset = benchmark_scan_trailing_zeros(mask);
 
-				break;
+				if (memcmp(data + i + offset + 1, scanNeedle + 1, needleLength - 2) == 0)
+					count++;
+
+				mask &= mask - 1;
 			}
+		}
 
-			case PIXAR_RAYTRACER_WALL: {
-				float
-					incidence = benchmark_pixar_raytracer_modulus(normal, lightDirection),
-					p = 6.283185f * benchmark_pixar_raytracer_random(),
-					c = benchmark_pixar_raytracer_random(),
-					s = sqrtf(1.0f - c),
-					g = normal.z < 0 ? -1.0f : 1.0f,
-					u = -1.0f / (g + normal.z),
-					v = normal.x * normal.y * u;
+		return count + benchmark_scan_search_scalar(data + i, length - i);
+	}
 
-				direction = benchmark_pixar_raytracer_add(benchmark_pixar_raytracer_add(STRUCT_INIT(Vector) { v, g + normal.y * normal.y * u, -normal.y * (cosf(p) * s) }, STRUCT_INIT(Vector) { 1.0f + g * normal.x * normal.x * u, g * v, -g * normal.x }), benchmark_pixar_raytracer_multiply_float(normal, sqrtf(c)));
-				origin = benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(sampledPosition, direction), 0.1f);
-				attenuation = benchmark_pixar_raytracer_multiply_float(attenuation, 0.2f);
+	// Muła and Lemire: each 16-byte lane turns 12 input bytes into 16 sextets with shuffles and multiplies, then maps them to ASCII with a 16-entry offset table
 
-				if (incidence > 0 && benchmark_pixar_raytracer_ray_marching(benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(sampledPosition, normal), 0.1f), lightDirection, &sampledPosition, &normal) == PIXAR_RAYTRACER_SUN)
-					color = benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_multiply(benchmark_pixar_raytracer_add(color, attenuation), STRUCT_INIT(Vector) { 500.0f, 400.0f, 100.0f }), incidence);
+	static size_t benchmark_scan_base64_encode_vector(const uint8_t* input, size_t length, uint8_t* output) {
+		const size_t consumed = SCAN_VECTOR / 4 * 3;
 
-				break;
-			}
+		size_t i = 0, written = 0;
 
-			case PIXAR_RAYTRACER_SUN: {
-				color = benchmark_pixar_raytracer_multiply(benchmark_pixar_raytracer_add(color, attenuation), STRUCT_INIT(Vector) { 50.0f, 80.0f, 100.0f });
+		for (; i + consumed + 4 <= length; i += consumed, written += SCAN_VECTOR) {
+			ScanVector bytes = SCAN_SHUFFLE(SCAN_LOAD_TRIPLETS(input + i), SCAN_TABLE(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+			ScanVector high = SCAN_MULTIPLY_HIGH(SCAN_AND(bytes, SCAN_SET32(0x0FC0FC00)), SCAN_SET32(0x04000040));
+			ScanVector low = SCAN_MULTIPLY_LOW(SCAN_AND(bytes, SCAN_SET32(0x003F03F0)), SCAN_SET32(0x01000010));
+			ScanVector indices = SCAN_OR(high, low);
+			ScanVector offsets = SCAN_SUBTRACT_SATURATED(indices, SCAN_SET(51));
 
-				goto escape;
-			}
+			offsets = SCAN_OR(offsets, SCAN_AND(SCAN_GREATER(SCAN_SET(26), indices), SCAN_SET(13)));
+			offsets = SCAN_SHUFFLE(SCAN_TABLE('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0), offsets);
+
+			SCAN_STORE(output + written, SCAN_ADD(offsets, indices));
 		}
+
+		return written + benchmark_scan_base64_encode_scalar(input + i, length - i, output + written);
 	}
 
-	escape:
+	// Nibble lookups validate and translate 16 characters per lane, multiply-adds pack the sextets and a shuffle gathers 12 bytes, the last quadruple with the padding is left to the scalar path
 
-	return color;
-}
+	static size_t benchmark_scan_base64_decode_vector(const uint8_t* input, size_t length, uint8_t* output) {
+		const size_t produced = SCAN_VECTOR / 4 * 3;
 
-EXPORT float benchmark_pixar_raytracer(uint32_t width, uint32_t height, uint32_t samples) {
-	marsagliaZ = 666;
-	marsagliaW = 999;
+		size_t i = 0, written = 0;
 
-	Vector position = { -22.0f, 5.0f, 25.0f };
-	Vector goal = { -3.0f, 4.0f, 0.0f };
+		if (length % 4 != 0)
+			return SIZE_MAX;
 
-	goal = benchmark_pixar_raytracer_add(benchmark_pixar_raytracer_inverse(goal), benchmark_pixar_raytracer_multiply_float(position, -1.0f));
+		for (; i + SCAN_VECTOR + 4 <= length; i += SCAN_VECTOR, written += produced) {
+			ScanVector characters = SCAN_LOAD(input + i);
+			ScanVector nibbles = SCAN_NIBBLES(characters);
+			ScanVector low = SCAN_SHUFFLE(SCAN_TABLE(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A), SCAN_AND(characters, SCAN_SET(0x0F)));
+			ScanVector high = SCAN_SHUFFLE(SCAN_TABLE(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10), nibbles);
+			ScanVector roll = SCAN_SHUFFLE(SCAN_TABLE(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0), SCAN_ADD(SCAN_EQUAL(characters, SCAN_SET('/')), nibbles));
 
-	Vector left = { goal.z, 0, goal.x };
+			if (!SCAN_ZERO(SCAN_AND(low, high)))
+				return SIZE_MAX;
 
-	left = benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_inverse(left), 1.0f / width);
+			ScanVector sextets = SCAN_ADD(characters, roll);
+			ScanVector packed = SCAN_MULTIPLY_ADD(SCAN_MULTIPLY_ADD_BYTES(sextets, SCAN_SET32(0x01400140)), SCAN_SET32(0x00011000));
 
-	Vector up = benchmark_pixar_raytracer_cross(goal, left);
-	Vector color = { 0 };
-	Vector adjust = { 0 };
+			packed = SCAN_SHUFFLE(packed, SCAN_TABLE(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
 
-	for (uint32_t y = height; y > 0; y--) {
-		for (uint32_t x = width; x > 0; x--) {
-			for (uint32_t p = samples; p > 0; p--) {
-				color = benchmark_pixar_raytracer_add(color, benchmark_pixar_raytracer_trace(position, benchmark_pixar_raytracer_add(benchmark_pixar_raytracer_inverse(benchmark_pixar_raytracer_multiply_float(benchmark_pixar_raytracer_add(goal, left), x - width / 2 + benchmark_pixar_raytracer_random())), benchmark_pixar_raytracer_multiply_float(up, y - height / 2 + benchmark_pixar_raytracer_random()))));
-			}
+			SCAN_STORE_TRIPLETS(output + written, packed);
+		}
 
-			color = benchmark_pixar_raytracer_multiply_float(color, (1.0f / samples) + 14.0f / 241.0f);
-			adjust = benchmark_pixar_raytracer_add_float(color, 1.0f);
-			color = STRUCT_INIT(Vector) {
-				color.x / adjust.x,
-				color.y / adjust.y,
-				color.z / adjust.z
-			};
+		size_t tail = benchmark_scan_base64_decode_scalar(input + i, length - i, output + written);
 
-			color = benchmark_pixar_raytracer_multiply_float(color, 255.0f);
-		}
+		return tail == SIZE_MAX ? SIZE_MAX : written + tail;
 	}
 
-	return color.x + color.y + color.z;
-}
+	// Keiser and Lemire: three nibble lookups classify every pair of adjacent bytes, and a saturated subtraction marks where a third or fourth continuation byte must follow
 
-// Fireflies Flocking
+	inline static void benchmark_scan_utf8_block(ScanVector input, ScanVector* previous, ScanVector* previousIncomplete, ScanVector* error, ScanVector incomplete) {
+		if (SCAN_MASK(input) == 0) {
+			*error = SCAN_OR(*error, *previousIncomplete);
+		} else {
+			ScanVector previous1 = SCAN_PREVIOUS(input, *previous, 1);
+			ScanVector previous2 = SCAN_PREVIOUS(input, *previous, 2);
+			ScanVector previous3 = SCAN_PREVIOUS(input, *previous, 3);
+
+			ScanVector byte1High = SCAN_SHUFFLE(SCAN_TABLE(
+				SCAN_UTF8_TOO_LONG, SCAN_UTF8_TOO_LONG, SCAN_UTF8_TOO_LONG, SCAN_UTF8_TOO_LONG,
+				SCAN_UTF8_TOO_LONG, SCAN_UTF8_TOO_LONG, SCAN_UTF8_TOO_LONG, SCAN_UTF8_TOO_LONG,
+				SCAN_UTF8_TWO_CONTINUATIONS, SCAN_UTF8_TWO_CONTINUATIONS, SCAN_UTF8_TWO_CONTINUATIONS, SCAN_UTF8_TWO_CONTINUATIONS,
+				SCAN_UTF8_TOO_SHORT | SCAN_UTF8_OVERLONG_2,
+				SCAN_UTF8_TOO_SHORT,
+				SCAN_UTF8_TOO_SHORT | SCAN_UTF8_OVERLONG_3 | SCAN_UTF8_SURROGATE,
+				SCAN_UTF8_TOO_SHORT | SCAN_UTF8_TOO_LARGE | SCAN_UTF8_TOO_LARGE_1000 | SCAN_UTF8_OVERLONG_4
+			), SCAN_NIBBLES(previous1));
+
+			ScanVector byte1Low = SCAN_SHUFFLE(SCAN_TABLE(
+				SCAN_UTF8_CARRY | SCAN_UTF8_OVERLONG_3 | SCAN_UTF8_OVERLONG_2 | SCAN_UTF8_OVERLONG_4,
+				SCAN_UTF8_CARRY | SCAN_UTF8_OVERLONG_2,
+				SCAN_UTF8_CARRY,
+				SCAN_UTF8_CARRY,
+				SCAN_UTF8_CARRY | SCAN_UTF8_TOO_LARGE,
+				SCAN_UTF8_CARRY | SCAN_UTF8_TOO_LARGE | SCAN_UTF8_TOO_LARGE_1000,
+				SCAN_UTF8_CARRY | SCAN_UTF8_TOO_LARGE | SCAN_UTF8_TOO_LARGE_1000,
+				SCAN_UTF8_CARRY | SCAN_UTF8_TOO_LARGE | SCAN_UTF8_TOO_LARGE_1000,
+				SCAN_UTF8_CARRY | SCAN_UTF8_TOO_LARGE | SCAN_UTF8_TOO_LARGE_1000,
+				SCAN_UTF8_CARRY | SCAN_UTF8_TOO_LARGE | SCAN_UTF8_TOO_LARGE_1000,
+				SCAN_UTF8_CARRY | SCAN_UTF8_TOO_LARGE | SCAN_UTF8_TOO_LARGE_1000,
+				SCAN_UTF8_CARRY | SCAN_UTF8_TOO_LARGE | SCAN_UTF8_TOO_LARGE_1000,
+				SCAN_UTF8_CARRY | SCAN_UTF8_TOO_LARGE | SCAN_UTF8_TOO_LARGE_1000,
+				SCAN_UTF8_CARRY | SCAN_UTF8_TOO_LARGE | SCAN_UTF8_TOO_LARGE_1000 | SCAN_UTF8_SURROGATE,
+				SCAN_UTF8_CARRY | SCAN_UTF8_TOO_LARGE | SCAN_UTF8_TOO_LARGE_1000,
+				SCAN_UTF8_CARRY | SCAN_UTF8_TOO_LARGE | SCAN_UTF8_TOO_LARGE_1000
+			), SCAN_AND(previous1, SCAN_SET(0x0F)));
+
+			ScanVector byte2High = SCAN_SHUFFLE(SCAN_TABLE(
+				SCAN_UTF8_TOO_SHORT, SCAN_UTF8_TOO_SHORT, SCAN_UTF8_TOO_SHORT, SCAN_UTF8_TOO_SHORT,
+				SCAN_UTF8_TOO_SHORT, SCAN_UTF8_TOO_SHORT, SCAN_UTF8_TOO_SHORT, SCAN_UTF8_TOO_SHORT,
+				SCAN_UTF8_TOO_LONG | SCAN_UTF8_OVERLONG_2 | SCAN_UTF8_TWO_CONTINUATIONS | SCAN_UTF8_OVERLONG_3 | SCAN_UTF8_TOO_LARGE_1000 | SCAN_UTF8_OVERLONG_4,
+				SCAN_UTF8_TOO_LONG | SCAN_UTF8_OVERLONG_2 | SCAN_UTF8_TWO_CONTINUATIONS | SCAN_UTF8_OVERLONG_3 | SCAN_UTF8_TOO_LARGE,
+				SCAN_UTF8_TOO_LONG | SCAN_UTF8_OVERLONG_2 | SCAN_UTF8_TWO_CONTINUATIONS | SCAN_UTF8_SURROGATE | SCAN_UTF8_TOO_LARGE,
+				SCAN_UTF8_TOO_LONG | SCAN_UTF8_OVERLONG_2 | SCAN_UTF8_TWO_CONTINUATIONS | SCAN_UTF8_SURROGATE | SCAN_UTF8_TOO_LARGE,
+				SCAN_UTF8_TOO_SHORT, SCAN_UTF8_TOO_SHORT, SCAN_UTF8_TOO_SHORT, SCAN_UTF8_TOO_SHORT
+			), SCAN_NIBBLES(input));
+
+			ScanVector special = SCAN_AND(SCAN_AND(byte1High, byte1Low), byte2High);
+			ScanVector continuation = SCAN_OR(SCAN_SUBTRACT_SATURATED(previous2, SCAN_SET(0xE0 - 0x80)), SCAN_SUBTRACT_SATURATED(previous3, SCAN_SET(0xF0 - 0x80)));
+
+			*error = SCAN_OR(*error, SCAN_XOR(SCAN_AND(continuation, SCAN_SET(0x80)), special));
+			*previousIncomplete = SCAN_SUBTRACT_SATURATED(input, incomplete);
+		}
 
-typedef struct _Boid {
-	Vector position, velocity, acceleration;
-} Boid;
+		*previous = input;
+	}
 
-static uint32_t parkMiller;
-static float maxSpeed;
-static float maxForce;
-static float separationDistance;
-static float neighbourDistance;
+	static int benchmark_scan_utf8_vector(const uint8_t* data, size_t length) {
+		const ScanVector incomplete = SCAN_LOAD(&scanIncomplete[32 - SCAN_VECTOR]);
 
-inline static void benchmark_fireflies_flocking_add(Vector* left, const Vector* right) {
-	left->x += right->x;
-	left->y += right->y;
-	left->z += right->z;
-}
+		ScanVector previous = SCAN_SET(0), previousIncomplete = SCAN_SET(0), error = SCAN_SET(0);
+		size_t i = 0;
 
-inline static void benchmark_fireflies_flocking_subtract(Vector* left, const Vector* right) {
-	left->x -= right->x;
-	left->y -= right->y;
-	left->z -= right->z;
-}
+		for (; i + SCAN_VECTOR <= length; i += SCAN_VECTOR) {
+			benchmark_scan_utf8_block(SCAN_LOAD(data + i), &previous, &previousIncomplete, &error, incomplete);
+		}
 
-inline static void benchmark_fireflies_flocking_divide(Vector* vector, float value) {
-	vector->x /= value;
-	vector->y /= value;
-	vector->z /= value;
-}
+		if (i < length) {
+			uint8_t tail[SCAN_VECTOR];
 
-inline static void benchmark_fireflies_flocking_multiply(Vector* vector, float value) {
-	vector->x *= value;
-	vector->y *= value;
-	vector->z *= value;
-}
+			memset(tail, ' ', SCAN_VECTOR);
+			memcpy(tail, data + i, length - i);
 
-inline static void benchmark_fireflies_flocking_normalize(Vector* vector) {
-	float length = sqrtf(vector->x * vector->x + vector->y * vector->y + vector->z * vector->z);
+			benchmark_scan_utf8_block(SCAN_LOAD(tail), &previous, &previousIncomplete, &error, incomplete);
+		}
 
-	vector->x /= length;
-	vector->y /= length;
-	vector->z /= length;
-}
+		error = SCAN_OR(error, previousIncomplete);
 
-inline static float benchmark_fireflies_flocking_length(Vector* vector) {
-	return sqrtf(vector->x * vector->x + vector->y * vector->y + vector->z * vector->z);
-}
+		return SCAN_ZERO(error);
+	}
+#endif
 
-inline static float benchmark_fireflies_flocking_random(void) {
-	parkMiller = (uint32_t)(((uint64_t)parkMiller * 48271u) % 0x7fffffff);
+// Width in bytes of the SIMD paths, 32 for AVX2, 16 for SSE4.2 and 0 when they fall back to the scalar references
 
-	return parkMiller / 10000000.0f;
+EXPORT uint32_t benchmark_scan_vector_width(void) {
+	return SCAN_VECTOR;
 }
 
-EXPORT float benchmark_fireflies_flocking(uint32_t boids, uint32_t lifetime) {
-	parkMiller = 666;
-	maxSpeed = 1.0f;
-	maxForce = 0.03f;
-	separationDistance = 15.0f;
-	neighbourDistance = 30.0f;
+// Streams over the buffer like seahash does, base64 hashes the encoded text with seahash after a round trip and returns 0 if the decoded bytes differ
 
-	Boid* fireflies = (Boid*)MALLOC(boids * sizeof(Boid), 16);
+EXPORT uint64_t benchmark_scan(uint32_t kernel, int vectorized, uint32_t iterations, uint32_t bufferLength) {
+	uint8_t* buffer = kernel == SCAN_BASE64 ? benchmark_seahash_buffer((int)bufferLength) : benchmark_scan_text(bufferLength);
+	uint8_t* encoded = NULL;
+	uint8_t* decoded = NULL;
+	size_t encodedLength = 0, decodedLength = 0;
+	uint64_t result = 0;
 
-	for (uint32_t i = 0; i < boids; ++i) {
-		fireflies[i].position = STRUCT_INIT(Vector) { benchmark_fireflies_flocking_random(), benchmark_fireflies_flocking_random(), benchmark_fireflies_flocking_random() };
-		fireflies[i].velocity = STRUCT_INIT(Vector) { benchmark_fireflies_flocking_random(), benchmark_fireflies_flocking_random(), benchmark_fireflies_flocking_random() };
-		fireflies[i].acceleration = STRUCT_INIT(Vector) { 0.0f, 0.0f, 0.0f };
+	if (kernel == SCAN_BASE64) {
+		encoded = (uint8_t*)MALLOC((bufferLength + 2) / 3 * 4 + SCAN_SLACK, 16);
+		decoded = (uint8_t*)MALLOC(bufferLength + SCAN_SLACK, 16);
 	}
 
-	for (uint32_t i = 0; i < lifetime; ++i) {
-		// Update
-		for (uint32_t boid = 0; boid < boids; ++boid) {
-			benchmark_fireflies_flocking_add(&fireflies[boid].velocity, &fireflies[boid].acceleration);
-
-			float speed = benchmark_fireflies_flocking_length(&fireflies[boid].velocity);
+	#if SCAN_VECTOR == 0
+		vectorized = 0;
+	#endif
 
-			if (speed > maxSpeed) {
-				benchmark_fireflies_flocking_divide(&fireflies[boid].velocity, speed);
-				benchmark_fireflies_flocking_multiply(&fireflies[boid].velocity, maxSpeed);
+	for (uint32_t i = 0; i < iterations; i++) {
+		HISTOGRAM_BEGIN();
+
+		#if SCAN_VECTOR > 0
+			if (vectorized) {
+				switch (kernel) {
+					case SCAN_DELIMITERS:
+						result = benchmark_scan_delimiters_vector(buffer, bufferLength);
+						break;
+
+					case SCAN_SEARCH:
+						result = benchmark_scan_search_vector(buffer, bufferLength);
+						break;
+
+					case SCAN_BASE64:
+						encodedLength = benchmark_scan_base64_encode_vector(buffer, bufferLength, encoded);
+						decodedLength = benchmark_scan_base64_decode_vector(encoded, encodedLength, decoded);
+						break;
+
+					case SCAN_UTF8:
+						result = (uint64_t)benchmark_scan_utf8_vector(buffer, bufferLength);
+						break;
+				}
+			}
+		#endif
+
+		if (!vectorized) {
+			switch (kernel) {
+				case SCAN_DELIMITERS:
+					result = benchmark_scan_delimiters_scalar(buffer, bufferLength);
+					break;
+
+				case SCAN_SEARCH:
+					result = benchmark_scan_search_scalar(buffer, bufferLength);
+					break;
+
+				case SCAN_BASE64:
+					encodedLength = benchmark_scan_base64_encode_scalar(buffer, bufferLength, encoded);
+					decodedLength = benchmark_scan_base64_decode_scalar(encoded, encodedLength, decoded);
+					break;
+
+				case SCAN_UTF8:
+					result = (uint64_t)benchmark_scan_utf8_scalar(buffer, bufferLength);
+					break;
 			}
-
-			benchmark_fireflies_flocking_add(&fireflies[boid].position, &fireflies[boid].velocity);
-			benchmark_fireflies_flocking_multiply(&fireflies[boid].acceleration, maxSpeed);
 		}
 
-		// Separation
-		for (uint32_t boid = 0; boid < boids; ++boid) {
-			Vector separation = { 0 };
-			int count = 0;
-
-			for (uint32_t target = 0; target < boids; ++target) {
-				Vector position = fireflies[boid].position;
-
-				benchmark_fireflies_flocking_subtract(&position, &fireflies[target].position);
-
-				float distance = benchmark_fireflies_flocking_length(&position);
+		HISTOGRAM_END();
+	}
 
-				if (distance > 0.0f && distance < separationDistance) {
-					benchmark_fireflies_flocking_normalize(&position);
-					benchmark_fireflies_flocking_divide(&position, distance);
+	if (kernel == SCAN_BASE64) {
+		if (iterations > 0 && decodedLength == bufferLength && memcmp(decoded, buffer, bufferLength) == 0)
+			result = benchmark_seahash_compute(encoded, encodedLength, 0x16F11FE89B0D677C, 0xB480A793D8E6C86C, 0x6FE2E5AAF078EBC9, 0x14F994A4C5259381);
 
-					separation = position;
-					count++;
-				}
-			}
+		FREE(encoded);
+		FREE(decoded);
+	}
 
-			if (count > 0) {
-				benchmark_fireflies_flocking_divide(&separation, (float)count);
-				benchmark_fireflies_flocking_normalize(&separation);
-				benchmark_fireflies_flocking_multiply(&separation, maxSpeed);
-				benchmark_fireflies_flocking_subtract(&separation, &fireflies[boid].velocity);
+	FREE(buffer);
 
-				float force = benchmark_fireflies_flocking_length(&separation);
+	return result;
+}
 
-				if (force > maxForce) {
-					benchmark_fireflies_flocking_divide(&separation, force);
-					benchmark_fireflies_flocking_multiply(&separation, maxForce);
-				}
+// Specialized
 
-				benchmark_fireflies_flocking_multiply(&separation, 1.5f);
-				benchmark_fireflies_flocking_add(&fireflies[boid].acceleration, &separation);
-			}
+#ifdef __cplusplus
+	// Calls the body with every index below the count in order, the recursion is resolved at compile time so each call sees a constant index
+
+	template <int Count>
+	struct SpecializedUnroll {
+		template <typename Body>
+		static inline void run(Body& body) {
+			SpecializedUnroll<Count - 1>::run(body);
+			body(Count - 1);
 		}
+	};
 
-		// Cohesion
-		for (uint32_t boid = 0; boid < boids; ++boid) {
-			Vector cohesion = { 0 };
-			int count = 0;
+	template <>
+	struct SpecializedUnroll<0> {
+		template <typename Body>
+		static inline void run(Body&) { }
+	};
 
-			for (uint32_t target = 0; target < boids; ++target) {
-				Vector position = fireflies[boid].position;
+	template <int Bodies>
+	static double benchmark_nbody_specialized(uint32_t advancements) {
+		static_assert(Bodies == 5, "The initial state describes the sun and four planets");
 
-				benchmark_fireflies_flocking_subtract(&position, &fireflies[target].position);
+		NBody bodies[Bodies] = { };
 
-				float distance = benchmark_fireflies_flocking_length(&position);
+		auto advance = [&](int i) {
+			NBody* bi = &bodies[i];
 
-				if (distance > 0.0f && distance < neighbourDistance) {
-					cohesion = fireflies[boid].position;
-					count++;
-				}
+			double
+				ix = bi->x,
+				iy = bi->y,
+				iz = bi->z,
+				ivx = bi->vx,
+				ivy = bi->vy,
+				ivz = bi->vz,
+				imass = bi->mass;
+
+			for (int j = i + 1; j < Bodies; j++) {
+				NBody* bj = &bodies[j];
+
+				double
+					dx = bj->x - ix,
+					dy = bj->y - iy,
+					dz = bj->z - iz,
+					jmass = bj->mass,
+					mag = 0.01 / benchmark_nbody_get_d2(dx, dy, dz);
+
+				bj->vx = bj->vx - dx * imass * mag;
+				bj->vy = bj->vy - dy * imass * mag;
+				bj->vz = bj->vz - dz * imass * mag;
+				ivx = ivx + dx * jmass * mag;
+				ivy = ivy + dy * jmass * mag;
+				ivz = ivz + dz * jmass * mag;
 			}
 
-			if (count > 0) {
-				benchmark_fireflies_flocking_divide(&cohesion, (float)count);
-				benchmark_fireflies_flocking_subtract(&cohesion, &fireflies[boid].position);
-				benchmark_fireflies_flocking_normalize(&cohesion);
-				benchmark_fireflies_flocking_multiply(&cohesion, maxSpeed);
-				benchmark_fireflies_flocking_subtract(&cohesion, &fireflies[boid].velocity);
-
-				float force = benchmark_fireflies_flocking_length(&cohesion);
+			bi->vx = ivx;
+			bi->vy = ivy;
+			bi->vz = ivz;
+			bi->x = ix + ivx * 0.01;
+			bi->y = iy + ivy * 0.01;
+			bi->z = iz + ivz * 0.01;
+		};
 
-				if (force > maxForce) {
-					benchmark_fireflies_flocking_divide(&cohesion, force);
-					benchmark_fireflies_flocking_multiply(&cohesion, maxForce);
-				}
+		benchmark_nbody_initialize_bodies(bodies, bodies + Bodies - 1);
+		benchmark_nbody_energy(bodies, bodies + Bodies - 1);
 
-				benchmark_fireflies_flocking_add(&fireflies[boid].acceleration, &cohesion);
-			}
+		while (--advancements > 0) {
+			SpecializedUnroll<Bodies>::run(advance);
 		}
-	}
 
-	FREE(fireflies);
-
-	return (float)parkMiller;
-}
+		benchmark_nbody_energy(bodies, bodies + Bodies - 1);
 
-// Polynomials
+		return bodies[0].x + bodies[0].y;
+	}
 
-EXPORT float benchmark_polynomials(uint32_t iterations) {
-	const float x = 0.2f;
+	template <uint32_t Size>
+	static uint32_t benchmark_sieve_of_eratosthenes_specialized(uint32_t iterations) {
+		uint8_t flags[Size];
+		uint32_t count = 0;
 
-	float pu = 0.0f;
-	float poly[100] = { 0 };
+		for (uint32_t a = 1; a <= iterations; a++) {
+			count = 0;
 
-	for (uint32_t i = 0; i < iterations; i++) {
-		float mu = 10.0f;
-		float s;
-		int j;
+			for (uint32_t b = 0; b < Size; b++) {
+				flags[b] = 1; // True
+			}
 
-		for (j = 0; j < 100; j++) {
-			poly[j] = mu = (mu + 2.0f) / 2.0f;
-		}
+			for (uint32_t b = 0; b < Size; b++) {
+				if (flags[b] == 1) {
+					uint32_t prime = b + b + 3;
 
-		s = 0.0f;
+					for (uint32_t c = b + prime; c < Size; c += prime) {
+						flags[c] = 0; // False
+					}
 
-		for (j = 0; j < 100; j++) {
-			s = x * s + poly[j];
+					count++;
+				}
+			}
 		}
 
-		pu += s;
+		return count;
 	}
 
-	return pu;
-}
+	template <int Terms>
+	static float benchmark_polynomials_specialized(uint32_t iterations) {
+		const float x = 0.2f;
 
-// Particle Kinematics
+		float pu = 0.0f;
+		float poly[Terms];
 
-typedef struct _Particle {
-	float x, y, z, vx, vy, vz;
-} Particle;
+		for (uint32_t i = 0; i < iterations; i++) {
+			float mu = 10.0f;
+			float s = 0.0f;
 
-EXPORT float benchmark_particle_kinematics(uint32_t quantity, uint32_t iterations) {
-	Particle* particles = (Particle*)MALLOC(quantity * sizeof(Particle), 16);
+			auto expand = [&](int j) {
+				poly[j] = mu = (mu + 2.0f) / 2.0f;
+			};
 
-	for (uint32_t i = 0; i < quantity; ++i) {
-		particles[i].x = (float)i;
-		particles[i].y = (float)(i + 1);
-		particles[i].z = (float)(i + 2);
-		particles[i].vx = 1.0f;
-		particles[i].vy = 2.0f;
-		particles[i].vz = 3.0f;
-	}
+			auto evaluate = [&](int j) {
+				s = x * s + poly[j];
+			};
 
-	for (uint32_t a = 0; a < iterations; ++a) {
-		for (uint32_t b = 0, c = quantity; b < c; ++b) {
-			Particle* p = &particles[b];
+			SpecializedUnroll<Terms>::run(expand);
+			SpecializedUnroll<Terms>::run(evaluate);
 
-			p->x += p->vx;
-			p->y += p->vy;
-			p->z += p->vz;
+			pu += s;
 		}
+
+		return pu;
 	}
 
-	Particle particle = { particles[0].x, particles[0].y, particles[0].z };
+	template <int KeyLength, int StreamLength>
+	static int benchmark_arcfour_specialized(uint32_t iterations) {
+		static const uint8_t key[] = { 0xDB, 0xB7, 0x60, 0xD4, 0x56 };
 
-	FREE(particles);
+		static_assert(sizeof(key) == KeyLength, "The key length must match the key");
 
-	return particle.x + particle.y + particle.z;
-}
+		uint8_t state[256];
+		uint8_t buffer[StreamLength];
+		uint32_t fold = 0;
 
-// Arcfour
+		for (uint32_t a = 0; a < iterations; a++) {
+			int i, j;
+			uint8_t t;
 
-inline static int benchmark_arcfour_key_setup(uint8_t* state, uint8_t* key, int length) {
-	int i, j;
-	uint8_t t;
+			for (i = 0; i < 256; ++i) {
+				state[i] = (uint8_t)i;
+			}
 
-	for (i = 0; i < 256; ++i) {
-		state[i] = (uint8_t)i;
-	}
+			for (i = 0, j = 0; i < 256; ++i) {
+				j = (j + state[i] + key[i % KeyLength]) % 256;
+				t = state[i];
+				state[i] = state[j];
+				state[j] = t;
+			}
 
-	for (i = 0, j = 0; i < 256; ++i) {
-		j = (j + state[i] + key[i % length]) % 256;
-		t = state[i];
-		state[i] = state[j];
-		state[j] = t;
-	}
+			i = 0;
+			j = 0;
 
-	return i;
-}
+			auto generate = [&](int index) {
+				i = (i + 1) % 256;
+				j = (j + state[i]) % 256;
+				t = state[i];
+				state[i] = state[j];
+				state[j] = t;
+				buffer[index] = state[(state[i] + state[j]) % 256];
+			};
 
-inline static int benchmark_arcfour_generate_stream(uint8_t* state, uint8_t* buffer, int length) {
-	int i, j;
-	int idx;
-	uint8_t t;
+			SpecializedUnroll<StreamLength>::run(generate);
 
-	for (idx = 0, i = 0, j = 0; idx < length; ++idx) {
-		i = (i + 1) % 256;
-		j = (j + state[i]) % 256;
-		t = state[i];
-		state[i] = state[j];
-		state[j] = t;
-		buffer[idx] = state[(state[i] + state[j]) % 256];
+			for (int k = 0; k < StreamLength; k++) {
+				fold = fold * 31 + buffer[k];
+			}
+		}
+
+		return (int)fold;
 	}
 
-	return i;
-}
+	template <int Length>
+	static int benchmark_radix_specialized(uint32_t iterations) {
+		classicRandom = 7525;
 
-EXPORT int benchmark_arcfour(uint32_t iterations) {
-	const int keyLength = 5;
-	const int streamLength = 10;
+		int array[Length];
+		int semiSorted[Length];
 
-	uint8_t* state = (uint8_t*)MALLOC(256, 8);
-	uint8_t* buffer = (uint8_t*)MALLOC(64, 8);
-	uint8_t key[keyLength];
-	uint8_t stream[streamLength];
+		for (uint32_t a = 0; a < iterations; a++) {
+			int largest = -1;
 
-	key[0] = 0xDB;
-	key[1] = 0xB7;
-	key[2] = 0x60;
-	key[3] = 0xD4;
-	key[4] = 0x56;
+			for (int b = 0; b < Length; b++) {
+				array[b] = benchmark_radix_random();
 
-	stream[0] = 0xEB;
-	stream[1] = 0x9F;
-	stream[2] = 0x77;
-	stream[3] = 0x81;
-	stream[4] = 0xB7;
-	stream[5] = 0x34;
-	stream[6] = 0xCA;
-	stream[7] = 0x72;
-	stream[8] = 0xA7;
-	stream[9] = 0x19;
+				if (array[b] > largest)
+					largest = array[b];
+			}
 
-	int idx = 0;
+			for (int significantDigit = 1; largest / significantDigit > 0; significantDigit *= 10) {
+				int bucket[10] = { 0 };
 
-	for (uint32_t i = 0; i < iterations; i++) {
-		idx = benchmark_arcfour_key_setup(state, key, keyLength);
-		idx = benchmark_arcfour_generate_stream(state, buffer, streamLength);
-	}
+				for (int i = 0; i < Length; i++) {
+					bucket[(array[i] / significantDigit) % 10]++;
+				}
 
-	FREE(state);
-	FREE(buffer);
+				for (int i = 1; i < 10; i++) {
+					bucket[i] += bucket[i - 1];
+				}
 
-	return idx;
-}
+				for (int i = Length - 1; i >= 0; i--) {
+					semiSorted[--bucket[(array[i] / significantDigit) % 10]] = array[i];
+				}
 
-// Seahash
+				for (int i = 0; i < Length; i++) {
+					array[i] = semiSorted[i];
+				}
+			}
+		}
 
-inline static uint64_t benchmark_seahash_read(uint8_t* pointer) {
-	return *(uint64_t*)pointer;
-}
+		return array[0];
+	}
+#endif
 
-inline static uint64_t benchmark_seahash_diffuse(uint64_t value) {
-	value *= 0x6EED0E9DA4D94A4F;
-	value ^= ((value >> 32) >> (int)(value >> 60));
-	value *= 0x6EED0E9DA4D94A4F;
+// Returns 1 when the library was built as C++ and the batch accepts the specialized kernels
 
-	return value;
+EXPORT int benchmark_specialized_available(void) {
+	#ifdef __cplusplus
+		return 1;
+	#else
+		return 0;
+	#endif
 }
 
-static uint64_t benchmark_seahash_compute(uint8_t* buffer, uint64_t length, uint64_t a, uint64_t b, uint64_t c, uint64_t d) {
-	const uint32_t blockSize = 32;
+// Batch
+
+typedef enum _BatchKernel {
+	BATCH_FIBONACCI = 0,
+	BATCH_MANDELBROT = 1,
+	BATCH_NBODY = 2,
+	BATCH_SIEVE_OF_ERATOSTHENES = 3,
+	BATCH_PIXAR_RAYTRACER = 4,
+	BATCH_FIREFLIES_FLOCKING = 5,
+	BATCH_POLYNOMIALS = 6,
+	BATCH_PARTICLE_KINEMATICS = 7,
+	BATCH_ARCFOUR = 8,
+	BATCH_SEAHASH = 9,
+	BATCH_RADIX = 10,
+	BATCH_SIEVE_OF_ERATOSTHENES_SIZED = 11,
+	BATCH_SEAHASH_SIZED = 12,
+	BATCH_RADIX_SIZED = 13,
+	BATCH_NBODY_SPECIALIZED = 14,
+	BATCH_SIEVE_OF_ERATOSTHENES_SPECIALIZED = 15,
+	BATCH_POLYNOMIALS_SPECIALIZED = 16,
+	BATCH_ARCFOUR_SPECIALIZED = 17,
+	BATCH_RADIX_SPECIALIZED = 18,
+	BATCH_SGEMM = 19,
+	BATCH_ARCFOUR_KEYSTREAM = 20
+} BatchKernel;
+
+typedef struct _BatchRun {
+	uint32_t kernel, repeat;
+	uint32_t parameters[3];
+} BatchRun;
+
+typedef struct _BatchResult {
+	uint64_t integer;
+	double real;
+	uint64_t nanoseconds, minimum, cycles;
+} BatchResult;
+
+// Runs every descriptor natively, stops at the first unknown kernel and returns the number of completed runs
+
+EXPORT int benchmark_batch(const BatchRun* runs, BatchResult* results, int count) {
+	for (int i = 0; i < count; i++) {
+		const BatchRun* run = &runs[i];
+		const uint32_t* parameters = run->parameters;
+		BatchResult* result = &results[i];
+
+		memset(result, 0, sizeof(BatchResult));
+
+		for (uint32_t repeat = 0; repeat < run->repeat; repeat++) {
+			uint64_t nanoseconds = benchmark_runner_nanoseconds();
+			uint64_t cycles = __rdtsc();
+
+			switch (run->kernel) {
+				case BATCH_FIBONACCI:
+					result->integer = benchmark_fibonacci(parameters[0]);
+					break;
+
+				case BATCH_MANDELBROT:
+					result->real = benchmark_mandelbrot(parameters[0], parameters[1], parameters[2]);
+					break;
+
+				case BATCH_NBODY:
+					result->real = benchmark_nbody(parameters[0]);
+					break;
+
+				case BATCH_SIEVE_OF_ERATOSTHENES:
+					result->integer = benchmark_sieve_of_eratosthenes(parameters[0]);
+					break;
+
+				case BATCH_PIXAR_RAYTRACER:
+					result->real = benchmark_pixar_raytracer(parameters[0], parameters[1], parameters[2]);
+					break;
+
+				case BATCH_FIREFLIES_FLOCKING:
+					result->real = benchmark_fireflies_flocking(parameters[0], parameters[1]);
+					break;
+
+				case BATCH_POLYNOMIALS:
+					result->real = benchmark_polynomials(parameters[0]);
+					break;
+
+				case BATCH_PARTICLE_KINEMATICS:
+					result->real = benchmark_particle_kinematics(parameters[0], parameters[1]);
+					break;
+
+				case BATCH_ARCFOUR:
+					result->integer = (uint64_t)benchmark_arcfour(parameters[0]);
+					break;
+
+				case BATCH_SEAHASH:
+					result->integer = benchmark_seahash(parameters[0]);
+					break;
+
+				case BATCH_RADIX:
+					result->integer = (uint64_t)benchmark_radix(parameters[0]);
+					break;
+
+				case BATCH_SIEVE_OF_ERATOSTHENES_SIZED:
+					result->integer = benchmark_sieve_of_eratosthenes_sized(parameters[0], parameters[1]);
+					break;
+
+				case BATCH_SEAHASH_SIZED:
+					result->integer = benchmark_seahash_sized(parameters[0], parameters[1]);
+					break;
+
+				case BATCH_RADIX_SIZED:
+					result->integer = (uint64_t)benchmark_radix_sized(parameters[0], parameters[1]);
+					break;
+
+				case BATCH_SGEMM:
+					result->real = benchmark_sgemm(parameters[0], parameters[1]);
+					break;
+
+				case BATCH_ARCFOUR_KEYSTREAM:
+					result->integer = (uint64_t)benchmark_arcfour_keystream(parameters[0]);
+					break;
+
+				#ifdef __cplusplus
+					case BATCH_NBODY_SPECIALIZED:
+						result->real = benchmark_nbody_specialized<5>(parameters[0]);
+						break;
+
+					case BATCH_SIEVE_OF_ERATOSTHENES_SPECIALIZED:
+						result->integer = benchmark_sieve_of_eratosthenes_specialized<1024>(parameters[0]);
+						break;
+
+					case BATCH_POLYNOMIALS_SPECIALIZED:
+						result->real = benchmark_polynomials_specialized<100>(parameters[0]);
+						break;
+
+					case BATCH_ARCFOUR_SPECIALIZED:
+						result->integer = (uint64_t)benchmark_arcfour_specialized<5, 10>(parameters[0]);
+						break;
+
+					case BATCH_RADIX_SPECIALIZED:
+						result->integer = (uint64_t)benchmark_radix_specialized<128>(parameters[0]);
+						break;
+				#endif
 
-	uint64_t end = length & ~(blockSize - 1);
+				default:
+					return i;
+			}
 
-	for (uint32_t i = 0; i < end; i += blockSize) {
-		a ^= benchmark_seahash_read(buffer + i);
-		b ^= benchmark_seahash_read(buffer + i + 8);
-		c ^= benchmark_seahash_read(buffer + i + 16);
-		d ^= benchmark_seahash_read(buffer + i + 24);
+			cycles = __rdtsc() - cycles;
+			nanoseconds = benchmark_runner_nanoseconds() - nanoseconds;
 
-		a = benchmark_seahash_diffuse(a);
-		b = benchmark_seahash_diffuse(b);
-		c = benchmark_seahash_diffuse(c);
-		d = benchmark_seahash_diffuse(d);
-	}
+			if (repeat == 0 || nanoseconds < result->minimum)
+				result->minimum = nanoseconds;
 
-	uint64_t excessive = length - end;
-	uint8_t* bufferEnd = buffer + end;
+			result->nanoseconds += nanoseconds;
+			result->cycles += cycles;
+		}
+	}
 
-	if (excessive > 0) {
-		a ^= benchmark_seahash_read(bufferEnd);
+	return count;
+}
 
-		if (excessive > 8) {
-			b ^= benchmark_seahash_read(bufferEnd);
+// Throughput
 
-			if (excessive > 16) {
-				c ^= benchmark_seahash_read(bufferEnd);
+typedef struct _ThroughputTask {
+	const BatchRun* run;
+	BatchResult* result;
+	volatile long* arrived;
+	volatile long* failed;
+	int processor, copies, pinned;
+	uint64_t begin, end;
+} ThroughputTask;
 
-				if (excessive > 24) {
-					d ^= benchmark_seahash_read(bufferEnd);
-					d = benchmark_seahash_diffuse(d);
-				}
+// Spins until every copy has arrived or one of them has failed, returns whether all of them arrived
 
-				c = benchmark_seahash_diffuse(c);
-			}
+inline static int benchmark_throughput_barrier(volatile long* arrived, volatile long* failed, int copies) {
+	#ifdef _MSC_VER
+		InterlockedIncrement(arrived);
 
-			b = benchmark_seahash_diffuse(b);
+		while (*arrived < copies && *failed == 0) {
+			_mm_pause();
 		}
 
-		a = benchmark_seahash_diffuse(a);
-	}
+		return *failed == 0;
+	#else
+		__atomic_add_fetch(arrived, 1, __ATOMIC_SEQ_CST);
 
-	a ^= b;
-	c ^= d;
-	a ^= c;
-	a ^= length;
+		while (__atomic_load_n(arrived, __ATOMIC_ACQUIRE) < copies && __atomic_load_n(failed, __ATOMIC_ACQUIRE) == 0) {
+			_mm_pause();
+		}
 
-	return benchmark_seahash_diffuse(a);
+		return __atomic_load_n(failed, __ATOMIC_ACQUIRE) == 0;
+	#endif
 }
 
-EXPORT uint64_t benchmark_seahash(uint32_t iterations) {
-	const int bufferLength = 1024 * 128;
+inline static void benchmark_throughput_fail(volatile long* failed) {
+	#ifdef _MSC_VER
+		InterlockedExchange(failed, 1);
+	#else
+		__atomic_store_n(failed, 1, __ATOMIC_RELEASE);
+	#endif
+}
 
-	uint8_t* buffer = (uint8_t*)MALLOC(bufferLength, 8);
+static void benchmark_throughput_task(ThroughputTask* task) {
+	task->pinned = benchmark_runner_pin(task->processor);
 
-	for (int i = 0; i < bufferLength; i++) {
-		buffer[i] = (uint8_t)(i % 256);
-	}
+	// An unpinned copy may share a processor with a spinning one, so it releases the others instead of entering the barrier
 
-	uint64_t hash = 0;
+	if (!task->pinned) {
+		benchmark_throughput_fail(task->failed);
 
-	for (uint32_t i = 0; i < iterations; i++) {
-		hash = benchmark_seahash_compute(buffer, bufferLength, 0x16F11FE89B0D677C, 0xB480A793D8E6C86C, 0x6FE2E5AAF078EBC9, 0x14F994A4C5259381);
+		return;
 	}
 
-	FREE(buffer);
+	if (!benchmark_throughput_barrier(task->arrived, task->failed, task->copies))
+		return;
 
-	return hash;
+	task->begin = benchmark_runner_nanoseconds();
+
+	benchmark_batch(task->run, task->result, 1);
+
+	task->end = benchmark_runner_nanoseconds();
 }
 
-// Radix
+#if defined(__linux__)
+	static void* benchmark_throughput_thread(void* task) {
+		benchmark_throughput_task((ThroughputTask*)task);
 
-static uint32_t classicRandom;
+		return NULL;
+	}
+#elif defined(_WIN32)
+	static DWORD WINAPI benchmark_throughput_thread(LPVOID task) {
+		benchmark_throughput_task((ThroughputTask*)task);
 
-inline static int benchmark_radix_random(void) {
-	classicRandom = (6253729 * classicRandom + 4396403);
+		return 0;
+	}
+#endif
 
-	return (int)(classicRandom % 32767);
-}
+// Runs every descriptor as an independent copy on its own thread pinned to the given processor, all copies are released together by a start barrier and the calling thread keeps its affinity, returns the nanoseconds from the first start to the last finish or 0 when a copy could not be started or pinned
 
-inline static int benchmark_radix_find_largest(int* array, int length) {
-	int i;
-	int largest = -1;
+EXPORT uint64_t benchmark_throughput(const BatchRun* runs, const int* processors, BatchResult* results, int copies) {
+	#if defined(__linux__) || defined(_WIN32)
+		const int maximumCopies = 256;
+	#else
+		const int maximumCopies = 0;
+	#endif
 
-	for (i = 0; i < length; i++) {
-		if (array[i] > largest)
-			largest = array[i];
+	ThroughputTask tasks[256];
+	volatile long arrived = 0, failed = 0;
+	uint64_t begin = UINT64_MAX, end = 0;
+
+	if (copies < 1 || copies > maximumCopies)
+		return 0;
+
+	for (int i = 0; i < copies; i++) {
+		tasks[i] = STRUCT_INIT(ThroughputTask) { &runs[i], &results[i], &arrived, &failed, processors[i], copies, 0, 0, 0 };
 	}
 
-	return largest;
-}
+	#if defined(__linux__)
+		pthread_t workers[256];
+		pthread_attr_t attributes;
+		struct sched_param parameters = { 0 };
+		int started = 0;
 
-static void benchmark_radix_sort(int* array, int length) {
-	int i;
-	ALLOCA(int, semiSorted, length);
-	int significantDigit = 1;
-	int largest = benchmark_radix_find_largest(array, length);
+		// The copies must not inherit SCHED_FIFO from a realtime runner, a spinning copy would never give up its processor
 
-	while (largest / significantDigit > 0) {
-		int bucket[10] = { 0 };
+		pthread_attr_init(&attributes);
+		pthread_attr_setinheritsched(&attributes, PTHREAD_EXPLICIT_SCHED);
+		pthread_attr_setschedpolicy(&attributes, SCHED_OTHER);
+		pthread_attr_setschedparam(&attributes, &parameters);
 
-		for (i = 0; i < length; i++) {
-			bucket[(array[i] / significantDigit) % 10]++;
+		for (; started < copies; started++) {
+			if (pthread_create(&workers[started], &attributes, benchmark_throughput_thread, &tasks[started]) != 0)
+				break;
 		}
 
-		for (i = 1; i < 10; i++) {
-			bucket[i] += bucket[i - 1];
-		}
+		pthread_attr_destroy(&attributes);
 
-		for (i = length - 1; i >= 0; i--) {
-			semiSorted[--bucket[(array[i] / significantDigit) % 10]] = array[i];
-		}
+		if (started < copies)
+			benchmark_throughput_fail(&failed);
 
-		for (i = 0; i < length; i++) {
-			array[i] = semiSorted[i];
+		for (int i = 0; i < started; i++) {
+			pthread_join(workers[i], NULL);
 		}
+	#elif defined(_WIN32)
+		HANDLE workers[256];
+		int started = 0;
 
-		significantDigit *= 10;
-	}
-}
-
-EXPORT int benchmark_radix(uint32_t iterations) {
-	classicRandom = 7525;
+		for (; started < copies; started++) {
+			workers[started] = CreateThread(NULL, 0, benchmark_throughput_thread, &tasks[started], 0, NULL);
 
-	const int arrayLength = 128;
+			if (workers[started] == NULL)
+				break;
+		}
 
-	int* array = (int*)MALLOC(arrayLength * sizeof(int), 16);
+		if (started < copies)
+			benchmark_throughput_fail(&failed);
 
-	for (uint32_t a = 0; a < iterations; a++) {
-		for (int b = 0; b < arrayLength; b++) {
-			array[b] = benchmark_radix_random();
+		for (int i = 0; i < started; i++) {
+			WaitForSingleObject(workers[i], INFINITE);
+			CloseHandle(workers[i]);
 		}
+	#endif
 
-		benchmark_radix_sort(array, arrayLength);
-	}
+	if (failed != 0)
+		return 0;
 
-	int head = array[0];
+	for (int i = 0; i < copies; i++) {
+		if (tasks[i].begin < begin)
+			begin = tasks[i].begin;
 
-	FREE(array);
+		if (tasks[i].end > end)
+			end = tasks[i].end;
+	}
 
-	return head;
+	return end - begin;
 }
\ No newline at end of file